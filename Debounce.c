@@ -0,0 +1,61 @@
+/**
+ ******************************************************************************
+ * @file    Debounce.c
+ * @brief   端口级按键消抖（垂直计数器）
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 每个引脚有一个 2 位递减计数器，16 个引脚的低位放在 Cnt0、高位放在 Cnt1，
+ * 一次更新用几条按位运算同时处理整个端口，耗时与按键数量无关：
+ * - 采样与稳定状态相同的引脚，计数器复位为 3；
+ * - 采样不同的引脚计数器减 1，连续 4 次不同（3 -> 2 -> 1 -> 0 -> 回绕）时
+ *   稳定状态翻转，计数器回到 3。
+ *
+ * 以 5ms 周期采样时，一次有效的按下或松开需要持续 20ms。
+ *
+ * 依赖：
+ * - stm32f10x.h
+ * - Debounce.h
+ ******************************************************************************
+ */
+
+#include "stm32f10x.h"                  // Device header
+#include "Debounce.h"
+
+/**
+ * @brief  初始化消抖状态
+ * @param  Debounce 消抖状态
+ * @param  State    初始稳定状态（通常为 0，即全部松开）
+ */
+void Debounce_Init(Debounce_t *Debounce, uint16_t State){
+	Debounce->Cnt0 = 0xFFFF;
+	Debounce->Cnt1 = 0xFFFF;
+	Debounce->State = State;
+	Debounce->Pressed = 0;
+	Debounce->Released = 0;
+}
+
+/**
+ * @brief  输入一次采样并更新稳定状态
+ * @param  Debounce 消抖状态
+ * @param  Sample   本次采样（1 = 按下）
+ * @retval 本次稳定状态发生翻转的引脚
+ * @note   翻转的引脚同时按方向写入 Pressed / Released。
+ */
+uint16_t Debounce_Update(Debounce_t *Debounce, uint16_t Sample){
+	uint16_t Toggle = Debounce->State ^ Sample;     // 与稳定状态不同的引脚
+	
+	// 不同的引脚计数器减 1，相同的引脚复位为 3
+	Debounce->Cnt0 = ~(Debounce->Cnt0 & Toggle);
+	Debounce->Cnt1 = Debounce->Cnt0 ^ (Debounce->Cnt1 & Toggle);
+	
+	// 计数器从 0 回绕到 3 的引脚翻转稳定状态
+	Toggle &= Debounce->Cnt0 & Debounce->Cnt1;
+	Debounce->State ^= Toggle;
+	Debounce->Pressed = Toggle & Debounce->State;
+	Debounce->Released = Toggle & ~Debounce->State;
+	
+	return Toggle;
+}
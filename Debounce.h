@@ -0,0 +1,47 @@
+/**
+ ******************************************************************************
+ * @file    Debounce.h
+ * @brief   端口级按键消抖（垂直计数器）头文件
+ * @note    声明消抖状态结构体与初始化、更新函数接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 一个 Debounce_t 对应一个 16 位端口，所有引脚同时消抖；
+ * - 输入为"按下 = 1"的采样值（低电平有效的引脚需先取反）；
+ * - 某引脚连续 DEBOUNCE_SAMPLES 次采样与稳定状态不同，稳定状态才翻转。
+ ******************************************************************************
+ */
+
+#ifndef __DEBOUNCE_H
+#define __DEBOUNCE_H
+
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEBOUNCE_SAMPLES    4   ///< 稳定状态翻转所需的连续采样次数（2 位计数器）
+
+/**
+ * @brief 消抖状态：每个引脚一个 2 位计数器，按位分别存放在 Cnt0、Cnt1 中
+ */
+typedef struct {
+	uint16_t Cnt0;          ///< 计数器低位
+	uint16_t Cnt1;          ///< 计数器高位
+	uint16_t State;         ///< 稳定状态（1 = 按下）
+	uint16_t Pressed;       ///< 最近一次更新中变为按下的引脚
+	uint16_t Released;      ///< 最近一次更新中变为松开的引脚
+} Debounce_t;
+
+/* 函数声明 -----------------------------------------------------------------*/
+void Debounce_Init(Debounce_t *Debounce, uint16_t State);
+uint16_t Debounce_Update(Debounce_t *Debounce, uint16_t Sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DEBOUNCE_H */
@@ -2,8 +2,9 @@
  ******************************************************************************
  * @file    EXTI_Init.c
  * @brief   提供 STM32F10x 外部中断 GPIO 初始化函数封装
- * @note    支持 GPIOA、GPIOB、GPIOC 引脚快速配置为外部中断输入模式，
- *          根据引脚编号自动映射 EXTI 线路与 NVIC 通道。
+ * @note    通过 EXTI_Register() 把任意端口的引脚注册为外部中断，并绑定回调函数，
+ *          根据引脚编号自动映射 EXTI 线路与 NVIC 通道；
+ *          全部 EXTI 中断服务函数由本文件提供，统一经回调表分发。
  * @version 1.0
  * @date    2025-10-07
  * @author  Jeffrey
@@ -11,190 +12,237 @@
  * @attention
  * - 本文件依赖 STM32 标准外设库 (stm32f10x_stdperiph_lib)。
  * - 在使用前请确保系统时钟、RCC 与 AFIO 已正确配置。
- * - 默认中断触发方式为下降沿触发 (Falling edge)。
+ * - EXTI_GPIOA_Init() 等函数保留为兼容接口：下降沿触发、无回调；
+ * - EXTI9_5、EXTI15_10 为多条线路共用的中断：读一次 EXTI->PR，
+ *   用前导零计数（CLZ）逐个取出挂起位并调用对应回调，耗时只与实际挂起的线路数有关。
  ******************************************************************************
  */
 
 #include "stm32f10x.h"  ///< STM32 标准外设库头文件
+#include "EXTI_Init.h"
+#include "IrqLatency.h"
+
+#define EXTI_SUBPRIORITY    2       ///< 所有 EXTI 通道使用的响应优先级
 
 /**
- * @brief  初始化 GPIOA 指定引脚为外部中断输入模式
- * @param  x: 引脚编号 (0~15)
- * @retval 无
+ * @brief 回调表项
+ */
+typedef struct
+{
+    EXTI_Callback_t Callback;   ///< 回调函数，可为 NULL
+    void *Ctx;                  ///< 传给回调的参数
+    uint8_t PortIndex;          ///< 占用该线路的端口（0 = GPIOA）
+} EXTI_Slot_t;
+
+static EXTI_Slot_t EXTI_Slots[16];      ///< 每条 EXTI 线一个回调
+static uint16_t EXTI_Used;              ///< 已注册的 EXTI 线
+static uint8_t EXTI_GroupReady;         ///< 是否已配置 NVIC 优先级分组
+
+/**
+ * @brief  注册外部中断
+ * @param  Port     GPIO 端口（GPIOA、GPIOB ...）
+ * @param  Pin      引脚编号 (0~15)，即 EXTI 线号
+ * @param  Trigger  触发方式：EXTI_Trigger_Rising / EXTI_Trigger_Falling / EXTI_Trigger_Rising_Falling
+ * @param  Priority 抢占优先级 (0~3，NVIC_PriorityGroup_2)
+ * @param  Callback 中断回调，在中断中调用，可为 NULL
+ * @param  Ctx      传给回调的参数
+ * @retval 0：成功
+ * @retval 1：该 EXTI 线已被其他端口的引脚占用
  * @note
- * - 自动开启 GPIOA 与 AFIO 时钟；
- * - 默认上拉输入模式；
- * - 默认下降沿触发；
- * - 自动判断对应的 NVIC 通道。
+ * - 自动开启 GPIO 与 AFIO 时钟；
+ * - 仅上升沿触发时配置为下拉输入，其余为上拉输入；
+ * - 同一端口同一引脚重复注册时更新触发方式与回调；
+ * - EXTI9_5、EXTI15_10 为共用通道，优先级以最后一次注册为准；
+ * - NVIC 优先级分组只在第一次注册时配置。
  */
-void EXTI_GPIOA_Init(uint16_t x)
+uint8_t EXTI_Register(GPIO_TypeDef *Port, uint8_t Pin, EXTITrigger_TypeDef Trigger,
+                      uint8_t Priority, EXTI_Callback_t Callback, void *Ctx)
 {
-    uint16_t pin = (1 << x);
-    uint32_t EXTIx_IRQn = 0;
+    uint16_t Line = 1 << Pin;
+    uint8_t PortIndex = ((uint32_t)Port - GPIOA_BASE) >> 10;   // GPIOA、GPIOB ... 等间隔排列
+    uint32_t EXTIx_IRQn;
+
+    if ((EXTI_Used & Line) && EXTI_Slots[Pin].PortIndex != PortIndex)
+        return 1;
 
     /*-------------------- 确定中断通道 --------------------*/
-    if (x <= 4)
-        EXTIx_IRQn = EXTI0_IRQn + x;
-    else if (x <= 9)
+    if (Pin <= 4)
+        EXTIx_IRQn = EXTI0_IRQn + Pin;
+    else if (Pin <= 9)
         EXTIx_IRQn = EXTI9_5_IRQn;
     else
         EXTIx_IRQn = EXTI15_10_IRQn;
 
+    /*-------------------- 回调表 --------------------*/
+    EXTI_Slots[Pin].Callback = Callback;
+    EXTI_Slots[Pin].Ctx = Ctx;
+    EXTI_Slots[Pin].PortIndex = PortIndex;
+    EXTI_Used |= Line;
+
     /*-------------------- 时钟开启 --------------------*/
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA | RCC_APB2Periph_AFIO, ENABLE);
+    RCC_APB2PeriphClockCmd((RCC_APB2Periph_GPIOA << PortIndex) | RCC_APB2Periph_AFIO, ENABLE);
 
     /*-------------------- GPIO 初始化 --------------------*/
     GPIO_InitTypeDef GPIO_InitStructure;
-    GPIO_InitStructure.GPIO_Pin = pin;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;         // 上拉输入
+    GPIO_InitStructure.GPIO_Pin = Line;
+    GPIO_InitStructure.GPIO_Mode = Trigger == EXTI_Trigger_Rising ? GPIO_Mode_IPD : GPIO_Mode_IPU;
     GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
-    GPIO_Init(GPIOA, &GPIO_InitStructure);
+    GPIO_Init(Port, &GPIO_InitStructure);
 
     /*-------------------- EXTI 线路配置 --------------------*/
-    GPIO_EXTILineConfig(GPIO_PortSourceGPIOA, x);
+    GPIO_EXTILineConfig(PortIndex, Pin);
 
     EXTI_InitTypeDef EXTI_InitStructure;
-    EXTI_InitStructure.EXTI_Line = (1 << x);
+    EXTI_InitStructure.EXTI_Line = Line;
     EXTI_InitStructure.EXTI_LineCmd = ENABLE;
     EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
-    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling; // 下降沿触发
+    EXTI_InitStructure.EXTI_Trigger = Trigger;
     EXTI_Init(&EXTI_InitStructure);
+    EXTI->PR = Line;                    // 丢弃配置过程中产生的挂起位
 
     /*-------------------- NVIC 配置 --------------------*/
-    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+    if (!EXTI_GroupReady)
+    {
+        NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+        EXTI_GroupReady = 1;
+    }
 
     NVIC_InitTypeDef NVIC_InitStructure;
     NVIC_InitStructure.NVIC_IRQChannel = EXTIx_IRQn;
     NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
-    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 2;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = Priority;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = EXTI_SUBPRIORITY;
     NVIC_Init(&NVIC_InitStructure);
+
+    return 0;
+}
+
+/**
+ * @brief  注销外部中断
+ * @param  Pin 引脚编号 (0~15)
+ * @note   关闭该 EXTI 线并清除回调；共用的 NVIC 通道保持开启。
+ */
+void EXTI_Unregister(uint8_t Pin)
+{
+    uint16_t Line = 1 << Pin;
+
+    EXTI->IMR &= ~Line;
+    EXTI->PR = Line;
+    EXTI_Slots[Pin].Callback = 0;
+    EXTI_Used &= ~Line;
+}
+
+/**
+ * @brief  初始化 GPIOA 指定引脚为外部中断输入模式
+ * @param  x: 引脚编号 (0~15)
+ * @retval 无
+ * @note   兼容接口：上拉输入、下降沿触发、抢占优先级 2、无回调，
+ *         需要处理中断时请使用 EXTI_Register()。
+ */
+void EXTI_GPIOA_Init(uint16_t x)
+{
+    EXTI_Register(GPIOA, x, EXTI_Trigger_Falling, 2, 0, 0);
 }
 
 /**
  * @brief  初始化 GPIOB 指定引脚为外部中断输入模式
  * @param  x: 引脚编号 (0~15)
  * @retval 无
- * @note
- * - 自动开启 GPIOB 与 AFIO 时钟；
- * - 默认上拉输入模式；
- * - 默认下降沿触发；
- * - 自动判断对应的 NVIC 通道。
+ * @note   兼容接口，同 EXTI_GPIOA_Init()。
  */
 void EXTI_GPIOB_Init(uint16_t x)
 {
-    uint16_t pin = (1 << x);
-    uint32_t EXTIx_IRQn = 0;
-
-    /*-------------------- 确定中断通道 --------------------*/
-    if (x <= 4)
-        EXTIx_IRQn = EXTI0_IRQn + x;
-    else if (x <= 9)
-        EXTIx_IRQn = EXTI9_5_IRQn;
-    else
-        EXTIx_IRQn = EXTI15_10_IRQn;
-
-    /*-------------------- 时钟开启 --------------------*/
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB | RCC_APB2Periph_AFIO, ENABLE);
-
-    /*-------------------- GPIO 初始化 --------------------*/
-    GPIO_InitTypeDef GPIO_InitStructure;
-    GPIO_InitStructure.GPIO_Pin = pin;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
-    GPIO_Init(GPIOB, &GPIO_InitStructure);
-
-    /*-------------------- EXTI 线路配置 --------------------*/
-    GPIO_EXTILineConfig(GPIO_PortSourceGPIOB, x);
-
-    EXTI_InitTypeDef EXTI_InitStructure;
-    EXTI_InitStructure.EXTI_Line = (1 << x);
-    EXTI_InitStructure.EXTI_LineCmd = ENABLE;
-    EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
-    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling;
-    EXTI_Init(&EXTI_InitStructure);
-
-    /*-------------------- NVIC 配置 --------------------*/
-    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
-
-    NVIC_InitTypeDef NVIC_InitStructure;
-    NVIC_InitStructure.NVIC_IRQChannel = EXTIx_IRQn;
-    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
-    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 2;
-    NVIC_Init(&NVIC_InitStructure);
+    EXTI_Register(GPIOB, x, EXTI_Trigger_Falling, 2, 0, 0);
 }
 
 /**
  * @brief  初始化 GPIOC 指定引脚为外部中断输入模式
  * @param  x: 引脚编号 (0~15)
  * @retval 无
- * @note
- * - 自动开启 GPIOC 与 AFIO 时钟；
- * - 默认上拉输入模式；
- * - 默认下降沿触发；
- * - 自动判断对应的 NVIC 通道。
+ * @note   兼容接口，同 EXTI_GPIOA_Init()。
  */
 void EXTI_GPIOC_Init(uint16_t x)
 {
-    uint16_t pin = (1 << x);
-    uint32_t EXTIx_IRQn = 0;
+    EXTI_Register(GPIOC, x, EXTI_Trigger_Falling, 2, 0, 0);
+}
 
-    /*-------------------- 确定中断通道 --------------------*/
-    if (x <= 4)
-        EXTIx_IRQn = EXTI0_IRQn + x;
-    else if (x <= 9)
-        EXTIx_IRQn = EXTI9_5_IRQn;
-    else
-        EXTIx_IRQn = EXTI15_10_IRQn;
+/**
+ * @brief  分发一个中断通道上的所有挂起线路
+ * @param  Mask 该通道对应的 EXTI 线
+ * @note   只读一次 PR，先写 1 清除再调用回调，回调执行期间的新边沿会重新挂起；
+ *         用 CLZ 从高位到低位逐个取出挂起位，没有逐位轮询。
+ */
+static void EXTI_Dispatch(uint32_t Mask)
+{
+    uint32_t Pending = EXTI->PR & Mask;
+    uint32_t Line;
 
-    /*-------------------- 时钟开启 --------------------*/
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC | RCC_APB2Periph_AFIO, ENABLE);
+    EXTI->PR = Pending;
+    while (Pending)
+    {
+        Line = 31 - __CLZ(Pending);
+        Pending &= ~(1UL << Line);
+        if (EXTI_Slots[Line].Callback)
+            EXTI_Slots[Line].Callback(EXTI_Slots[Line].Ctx);
+    }
+}
 
-    /*-------------------- GPIO 初始化 --------------------*/
-    GPIO_InitTypeDef GPIO_InitStructure;
-    GPIO_InitStructure.GPIO_Pin = pin;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
-    GPIO_Init(GPIOC, &GPIO_InitStructure);
+/**
+ * @brief  单线路中断：直接清除挂起位并调用回调
+ */
+static void EXTI_DispatchOne(uint8_t Line)
+{
+    EXTI->PR = 1 << Line;
+    if (EXTI_Slots[Line].Callback)
+        EXTI_Slots[Line].Callback(EXTI_Slots[Line].Ctx);
+}
 
-    /*-------------------- EXTI 线路配置 --------------------*/
-    GPIO_EXTILineConfig(GPIO_PortSourceGPIOC, x);
+/*-------------------- 中断服务函数 --------------------*/
+void EXTI0_IRQHandler(void)
+{
+    IRQ_LATENCY_ENTER(IRQLAT_EXTI0);
+    EXTI_DispatchOne(0);
+    IRQ_LATENCY_EXIT(IRQLAT_EXTI0);
+}
 
-    EXTI_InitTypeDef EXTI_InitStructure;
-    EXTI_InitStructure.EXTI_Line = (1 << x);
-    EXTI_InitStructure.EXTI_LineCmd = ENABLE;
-    EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
-    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling;
-    EXTI_Init(&EXTI_InitStructure);
+void EXTI1_IRQHandler(void)
+{
+    IRQ_LATENCY_ENTER(IRQLAT_EXTI1);
+    EXTI_DispatchOne(1);
+    IRQ_LATENCY_EXIT(IRQLAT_EXTI1);
+}
 
-    /*-------------------- NVIC 配置 --------------------*/
-    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+void EXTI2_IRQHandler(void)
+{
+    IRQ_LATENCY_ENTER(IRQLAT_EXTI2);
+    EXTI_DispatchOne(2);
+    IRQ_LATENCY_EXIT(IRQLAT_EXTI2);
+}
 
-    NVIC_InitTypeDef NVIC_InitStructure;
-    NVIC_InitStructure.NVIC_IRQChannel = EXTIx_IRQn;
-    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
-    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 2;
-    NVIC_Init(&NVIC_InitStructure);
+void EXTI3_IRQHandler(void)
+{
+    IRQ_LATENCY_ENTER(IRQLAT_EXTI3);
+    EXTI_DispatchOne(3);
+    IRQ_LATENCY_EXIT(IRQLAT_EXTI3);
+}
+
+void EXTI4_IRQHandler(void)
+{
+    IRQ_LATENCY_ENTER(IRQLAT_EXTI4);
+    EXTI_DispatchOne(4);
+    IRQ_LATENCY_EXIT(IRQLAT_EXTI4);
 }
 
-/**
- * @brief  EXTI9_5 中断服务函数示例
- * @retval 无
- * @note
- * - 本函数示例演示如何处理中断事件；
- * - 用户可在其中加入自定义逻辑。
- */
 void EXTI9_5_IRQHandler(void)
 {
-    if (EXTI_GetITStatus(EXTI_Line5) == SET)
-    {
-        /*-------------------- 用户代码区 --------------------*/
-        // 示例：中断响应处理逻辑
-        // TODO: 用户可根据实际需要修改
-        /*----------------------------------------------------*/
+    IRQ_LATENCY_ENTER(IRQLAT_EXTI9_5);
+    EXTI_Dispatch(0x03E0);          // 线 5~9
+    IRQ_LATENCY_EXIT(IRQLAT_EXTI9_5);
+}
 
-        EXTI_ClearITPendingBit(EXTI_Line5); // 清除中断标志位
-    }
+void EXTI15_10_IRQHandler(void)
+{
+    IRQ_LATENCY_ENTER(IRQLAT_EXTI15_10);
+    EXTI_Dispatch(0xFC00);          // 线 10~15
+    IRQ_LATENCY_EXIT(IRQLAT_EXTI15_10);
 }
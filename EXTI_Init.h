@@ -2,14 +2,16 @@
  ******************************************************************************
  * @file    EXTI_Init.h
  * @brief   STM32F10x 外部中断 GPIO 初始化函数头文件
- * @note    声明 GPIOA、GPIOB、GPIOC 外部中断输入初始化函数接口。
+ * @note    声明外部中断注册接口与 GPIOA、GPIOB、GPIOC 兼容初始化函数接口。
  * @version 1.0
  * @date    2025-10-07
  * @author  Jeffrey
  ******************************************************************************
  * @attention
  * - 本头文件需与 EXTI_Init.c 搭配使用；
- * - 在调用函数前，请确保 RCC 时钟与 NVIC 中断优先级组已正确配置；
+ * - 本模块提供全部 EXTI 中断服务函数，应用中不要再定义 EXTIx_IRQHandler，
+ *   而是通过 EXTI_Register() 注册回调；
+ * - 回调在中断中执行，应尽量简短；
  * - 需包含标准外设库头文件 "stm32f10x.h"。
  ******************************************************************************
  */
@@ -23,6 +25,15 @@
 extern "C" {
 #endif
 
+/**
+ * @brief 外部中断回调函数类型
+ * @param Ctx 注册时传入的参数
+ */
+typedef void (*EXTI_Callback_t)(void *Ctx);
+
+uint8_t EXTI_Register(GPIO_TypeDef *Port, uint8_t Pin, EXTITrigger_TypeDef Trigger,
+                      uint8_t Priority, EXTI_Callback_t Callback, void *Ctx);
+void EXTI_Unregister(uint8_t Pin);
 
 void EXTI_GPIOA_Init(uint16_t x);
 void EXTI_GPIOB_Init(uint16_t x);
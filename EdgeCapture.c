@@ -0,0 +1,249 @@
+/**
+ ******************************************************************************
+ * @file    EdgeCapture.c
+ * @brief   基于 EXTI 与 DWT 周期计数器的边沿时间戳与脉冲测量
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 中断（EXTI 回调）只做固定的几步：读 CYCCNT、读引脚电平、写入本通道的环形缓冲。
+ * 电平放在时间戳的最低位，bit1 标记“此前有边沿因缓冲满而丢失”，一个边沿只占一个 32 位字，
+ * 代价是时间戳分辨率降为 4 个周期。处理到带丢失标记的边沿时重新等待参考边沿，
+ * 避免跨越丢失边沿的周期与高电平时间进入统计。
+ * 缓冲为单生产者 / 单消费者结构（与 KeyEvent.c 相同），Head 只由中断修改，
+ * Tail 只由 EdgeCapture_Process() 修改，无需关中断。
+ *
+ * 统计在主循环中完成：周期的最小、最大、平均值与标准差，高电平时间、占空比与频率。
+ * 平均值与标准差用相对第一个周期的偏差累计整数和与平方和（int64，不丢精度），
+ * 在 EdgeCapture_GetStats() 中才换算为均值与均方根。
+ *
+ * 依赖：
+ * - stm32f10x.h
+ * - MyDWT.h
+ * - EXTI_Init.h
+ * - EdgeCapture.h
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include "stm32f10x.h"                  // Device header
+#include "MyDWT.h"
+#include "EXTI_Init.h"
+#include "EdgeCapture.h"
+
+#define EDGECAP_MASK        (EDGECAP_SIZE - 1)
+
+/**
+ * @brief 单个通道
+ */
+typedef struct {
+	GPIO_TypeDef *Port;             ///< GPIO 端口
+	uint16_t Pin;                   ///< 引脚掩码
+	uint8_t BothEdges;              ///< 是否双边沿触发
+	volatile uint8_t Head;          ///< 下一个写入位置（中断）
+	volatile uint8_t Tail;          ///< 下一个读取位置（主循环）
+	volatile uint32_t Dropped;      ///< 缓冲满丢失的边沿数（中断）
+	uint32_t LastDropped;           ///< 上次写入时已标记过的丢失数（中断）
+	uint32_t Ring[EDGECAP_SIZE];    ///< 时间戳，bit0 为边沿后的电平，bit1 为丢失标记
+	
+	/* 以下只由 EdgeCapture_Process() 使用 */
+	uint8_t Started;                ///< 是否已有参考边沿
+	uint32_t LastStart;             ///< 上一个周期起点（上升沿或任意边沿）
+	uint32_t LastEdge;              ///< 最近一个边沿
+	uint32_t FirstPeriod;           ///< 第一个周期，作为偏差的参考
+	int64_t Sum;                    ///< 各周期与 FirstPeriod 之差的和
+	uint64_t SumSq;                 ///< 各周期与 FirstPeriod 之差的平方和
+	EdgeCapture_Stats_t Stats;      ///< 统计结果
+} EdgeCapture_Channel_t;
+
+static EdgeCapture_Channel_t EdgeCapture_Channels[EDGECAP_CHANNELS];
+static uint8_t EdgeCapture_Count;
+
+/**
+ * @brief  EXTI 回调：记录边沿时间戳
+ * @param  Ctx 通道
+ */
+static void EdgeCapture_Isr(void *Ctx){
+	uint32_t Cycles = MyDWT_GetCycles();
+	EdgeCapture_Channel_t *Ch = Ctx;
+	uint8_t Head = Ch->Head;
+	
+	if((uint8_t)(Head - Ch->Tail) >= EDGECAP_SIZE){
+		Ch->Dropped++;
+		return;
+	}
+	Ch->Ring[Head & EDGECAP_MASK] = (Cycles & ~3UL) | (Ch->Dropped != Ch->LastDropped) << 1 | ((Ch->Port->IDR & Ch->Pin) != 0);
+	Ch->LastDropped = Ch->Dropped;
+	__DMB();
+	Ch->Head = Head + 1;
+}
+
+/**
+ * @brief  添加一个测量通道
+ * @param  Port     GPIO 端口
+ * @param  Pin      引脚编号 (0~15)
+ * @param  Trigger  触发方式，测量占空比时使用 EXTI_Trigger_Rising_Falling
+ * @param  Priority EXTI 抢占优先级 (0~3)
+ * @retval 通道号；0xFF 表示通道已满或 EXTI 线被占用
+ * @note   第一次调用时初始化 DWT 周期计数器。
+ */
+uint8_t EdgeCapture_Add(GPIO_TypeDef *Port, uint8_t Pin, EXTITrigger_TypeDef Trigger, uint8_t Priority){
+	EdgeCapture_Channel_t *Ch;
+	
+	if(EdgeCapture_Count >= EDGECAP_CHANNELS){
+		return 0xFF;
+	}
+	if(EdgeCapture_Count == 0){
+		MyDWT_Init();
+	}
+	
+	Ch = &EdgeCapture_Channels[EdgeCapture_Count];
+	Ch->Port = Port;
+	Ch->Pin = 1 << Pin;
+	Ch->BothEdges = Trigger == EXTI_Trigger_Rising_Falling;
+	Ch->Head = 0;
+	Ch->Tail = 0;
+	EdgeCapture_ResetStats(EdgeCapture_Count);
+	
+	if(EXTI_Register(Port, Pin, Trigger, Priority, EdgeCapture_Isr, Ch)){
+		return 0xFF;
+	}
+	return EdgeCapture_Count++;
+}
+
+/**
+ * @brief  处理一个边沿
+ */
+static void EdgeCapture_Edge(EdgeCapture_Channel_t *Ch, uint32_t Stamp){
+	EdgeCapture_Stats_t *Stats = &Ch->Stats;
+	uint32_t Cycles = Stamp & ~3UL;
+	uint32_t Period;
+	int64_t Delta;
+	
+	Stats->Edges++;
+	Ch->LastEdge = Cycles;
+	
+	// 此前有边沿丢失：与上一个参考边沿之间的间隔无效，重新开始
+	if(Stamp & 2){
+		Ch->Started = 0;
+	}
+	
+	// 双边沿触发：下降沿结束高电平
+	if(Ch->BothEdges && !(Stamp & 1)){
+		if(Ch->Started){
+			Stats->High = Cycles - Ch->LastStart;
+		}
+		return;
+	}
+	
+	if(!Ch->Started){
+		Ch->Started = 1;
+		Ch->LastStart = Cycles;
+		return;
+	}
+	
+	Period = Cycles - Ch->LastStart;
+	Ch->LastStart = Cycles;
+	if(Period == 0){
+		return;
+	}
+	
+	Stats->Periods++;
+	Stats->Period = Period;
+	if(Period < Stats->PeriodMin){
+		Stats->PeriodMin = Period;
+	}
+	if(Period > Stats->PeriodMax){
+		Stats->PeriodMax = Period;
+	}
+	
+	// 相对第一个周期的偏差很小，整数累计不会溢出，也不会像浮点那样随周期数增大而丢失精度
+	if(Stats->Periods == 1){
+		Ch->FirstPeriod = Period;
+	}
+	Delta = (int64_t)Period - Ch->FirstPeriod;
+	Ch->Sum += Delta;
+	Ch->SumSq += (uint64_t)(Delta * Delta);
+	
+	Stats->Frequency = (uint64_t)SystemCoreClock * 1000 / Period;
+	if(Ch->BothEdges){
+		Stats->Duty = Stats->High < Period ? (uint64_t)Stats->High * 1000 / Period : 1000;
+	}
+}
+
+/**
+ * @brief  后台处理：取出所有通道中的时间戳并更新统计
+ * @note   在主循环中周期调用。
+ */
+void EdgeCapture_Process(void){
+	EdgeCapture_Channel_t *Ch;
+	uint8_t c, Tail;
+	
+	for(c = 0; c < EdgeCapture_Count; c++){
+		Ch = &EdgeCapture_Channels[c];
+		Tail = Ch->Tail;
+		while(Tail != Ch->Head){
+			__DMB();
+			EdgeCapture_Edge(Ch, Ch->Ring[Tail & EDGECAP_MASK]);
+			Tail++;
+			Ch->Tail = Tail;
+		}
+	}
+}
+
+/**
+ * @brief  读取通道统计
+ * @param  Channel 通道号
+ * @param  Stats   接收统计的结构体
+ * @note   超过 1 秒没有边沿时 Frequency 与 Duty 返回 0。
+ *         平均周期与均方根抖动在此由累计和计算，应与 EdgeCapture_Process() 在同一上下文中调用。
+ */
+void EdgeCapture_GetStats(uint8_t Channel, EdgeCapture_Stats_t *Stats){
+	EdgeCapture_Channel_t *Ch;
+	double Mean, Var;
+	
+	if(Channel >= EdgeCapture_Count){
+		return;
+	}
+	Ch = &EdgeCapture_Channels[Channel];
+	*Stats = Ch->Stats;
+	Stats->Dropped = Ch->Dropped;
+	if(Stats->Periods){
+		Mean = (double)Ch->Sum / Stats->Periods;
+		Var = (double)Ch->SumSq / Stats->Periods - Mean * Mean;
+		Stats->PeriodMean = (uint32_t)(Ch->FirstPeriod + Mean + 0.5);
+		Stats->JitterRms = Var > 0 ? (uint32_t)(sqrt(Var) + 0.5) : 0;
+	}
+	if(Stats->Edges == 0 || MyDWT_GetCycles() - Ch->LastEdge > SystemCoreClock){
+		Stats->Frequency = 0;
+		Stats->Duty = 0;
+	}
+}
+
+/**
+ * @brief  清除通道统计（不影响缓冲中尚未处理的边沿）
+ * @param  Channel 通道号
+ */
+void EdgeCapture_ResetStats(uint8_t Channel){
+	EdgeCapture_Channel_t *Ch;
+	
+	if(Channel >= EDGECAP_CHANNELS){
+		return;
+	}
+	Ch = &EdgeCapture_Channels[Channel];
+	Ch->Started = 0;
+	Ch->FirstPeriod = 0;
+	Ch->Sum = 0;
+	Ch->SumSq = 0;
+	Ch->Stats.Edges = 0;
+	Ch->Stats.Periods = 0;
+	Ch->Stats.Period = 0;
+	Ch->Stats.PeriodMin = 0xFFFFFFFF;
+	Ch->Stats.PeriodMax = 0;
+	Ch->Stats.PeriodMean = 0;
+	Ch->Stats.JitterRms = 0;
+	Ch->Stats.High = 0;
+	Ch->Stats.Duty = 0;
+	Ch->Stats.Frequency = 0;
+}
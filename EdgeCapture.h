@@ -0,0 +1,60 @@
+/**
+ ******************************************************************************
+ * @file    EdgeCapture.h
+ * @brief   基于 EXTI 与 DWT 周期计数器的边沿时间戳与脉冲测量头文件
+ * @note    声明通道注册、后台处理与统计读取函数接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 中断中只记录时间戳（固定几条指令），统计全部在 EdgeCapture_Process() 中完成，
+ *   需在主循环中周期调用，两次调用之间的边沿数不能超过 EDGECAP_SIZE；
+ * - 时间基准为 DWT CYCCNT，时间戳分辨率为 4 个周期（72MHz 时约 56ns），单个周期不能超过约 59 秒；
+ * - 缓冲溢出丢失边沿后，从下一个参考边沿重新开始测量，丢失期间不产生周期；
+ * - 双边沿触发时按上升沿计算周期，并测量高电平时间与占空比；
+ *   单边沿触发时按相邻边沿计算周期。
+ ******************************************************************************
+ */
+
+#ifndef __EDGECAPTURE_H
+#define __EDGECAPTURE_H
+
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+#define EDGECAP_CHANNELS    4       ///< 最大通道数
+#define EDGECAP_SIZE        32      ///< 每通道时间戳缓冲容量，必须为 2 的幂且不超过 128
+
+/**
+ * @brief 通道统计（单位：CPU 周期，除非另有说明）
+ */
+typedef struct {
+	uint32_t Edges;         ///< 已处理的边沿数
+	uint32_t Dropped;       ///< 缓冲满而丢失的边沿数
+	uint32_t Periods;       ///< 已测得的周期数
+	uint32_t Period;        ///< 最近一个周期
+	uint32_t PeriodMin;     ///< 最小周期
+	uint32_t PeriodMax;     ///< 最大周期
+	uint32_t PeriodMean;    ///< 平均周期
+	uint32_t JitterRms;     ///< 周期的均方根抖动（标准差）
+	uint32_t High;          ///< 最近一次高电平时间（仅双边沿触发）
+	uint16_t Duty;          ///< 占空比（0.1%，仅双边沿触发）
+	uint32_t Frequency;     ///< 频率（mHz），超过 1 秒没有边沿时为 0
+} EdgeCapture_Stats_t;
+
+/* 函数声明 -----------------------------------------------------------------*/
+uint8_t EdgeCapture_Add(GPIO_TypeDef *Port, uint8_t Pin, EXTITrigger_TypeDef Trigger, uint8_t Priority);
+void EdgeCapture_Process(void);
+void EdgeCapture_GetStats(uint8_t Channel, EdgeCapture_Stats_t *Stats);
+void EdgeCapture_ResetStats(uint8_t Channel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EDGECAPTURE_H */
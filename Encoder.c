@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file    Encoder.c
+ * @brief   TIM3 正交编码器接口实现文件
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 本文件默认使用 TIM3_CH1 (PA6) 与 TIM3_CH2 (PA7) 接编码器 A、B 相，
+ *   如需更换其他定时器，请修改对应的时钟、引脚与寄存器；
+ * - 位置与增量只在主循环中读取，速度只在定时中断中更新，二者互不干扰，无需关中断。
+ ******************************************************************************
+ */
+
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+#include "Encoder.h"
+
+static int32_t Encoder_Position;        ///< 32 位累计位置
+static int32_t Encoder_DeltaBase;       ///< 上次 Encoder_GetDelta() 时的位置
+static uint16_t Encoder_Last;           ///< 上次累加时的计数器值
+
+static volatile int32_t Encoder_Velocity;   ///< 速度（计数/秒）
+
+/**
+ * @brief  TIM3 编码器接口初始化函数
+ * @note   默认使用 PA6 -> CH1，PA7 -> CH2，上拉输入
+ * @retval 无
+ */
+void Encoder_Init(void)
+{
+    /* 打开时钟 */
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);
+
+    /* GPIO 配置 */
+    GPIO_InitTypeDef GPIO_InitStructure;
+    GPIO_InitStructure.GPIO_Mode  = GPIO_Mode_IPU;     // 上拉输入
+    GPIO_InitStructure.GPIO_Pin   = GPIO_Pin_6 | GPIO_Pin_7;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+    /* 定时器基本配置：计数时钟由编码器提供，ARR 取满量程 */
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStructure;
+    TIM_TimeBaseInitStructure.TIM_ClockDivision      = TIM_CKD_DIV1;
+    TIM_TimeBaseInitStructure.TIM_CounterMode        = TIM_CounterMode_Up;
+    TIM_TimeBaseInitStructure.TIM_Period             = 65536 - 1;   // ARR
+    TIM_TimeBaseInitStructure.TIM_Prescaler          = 1 - 1;       // PSC
+    TIM_TimeBaseInitStructure.TIM_RepetitionCounter  = 0x00;
+    TIM_TimeBaseInit(TIM3, &TIM_TimeBaseInitStructure);
+
+    /* 输入捕获通道：只用于配置输入滤波 */
+    TIM_ICInitTypeDef TIM_ICInitStructure;
+    TIM_ICStructInit(&TIM_ICInitStructure);
+    TIM_ICInitStructure.TIM_ICFilter = ENCODER_FILTER;
+
+    TIM_ICInitStructure.TIM_Channel = TIM_Channel_1;
+    TIM_ICInit(TIM3, &TIM_ICInitStructure);
+
+    TIM_ICInitStructure.TIM_Channel = TIM_Channel_2;
+    TIM_ICInit(TIM3, &TIM_ICInitStructure);
+
+    /* 编码器模式：TI1、TI2 双边沿计数，方向与 A、B 相序有关 */
+    TIM_EncoderInterfaceConfig(TIM3, TIM_EncoderMode_TI12, TIM_ICPolarity_Rising, TIM_ICPolarity_Rising);
+
+    TIM_SetCounter(TIM3, 0);
+    Encoder_Position = 0;
+    Encoder_DeltaBase = 0;
+    Encoder_Last = 0;
+    Encoder_Velocity = 0;
+
+    /* 使能定时器 */
+    TIM_Cmd(TIM3, ENABLE);
+}
+
+/**
+ * @brief  把硬件计数器的变化累加到 32 位位置
+ * @note   16 位计数差按有符号数解释，因此两次调用之间不能超过 32767 个计数。
+ */
+static void Encoder_Sync(void)
+{
+    uint16_t Count = TIM_GetCounter(TIM3);
+
+    Encoder_Position += (int16_t)(Count - Encoder_Last);
+    Encoder_Last = Count;
+}
+
+/**
+ * @brief  获取累计位置
+ * @retval 32 位位置（计数，4 倍频）
+ */
+int32_t Encoder_GetPosition(void)
+{
+    Encoder_Sync();
+    return Encoder_Position;
+}
+
+/**
+ * @brief  设置累计位置（不影响 Encoder_GetDelta() 的结果）
+ * @param  Position 新的位置
+ */
+void Encoder_SetPosition(int32_t Position)
+{
+    Encoder_Sync();
+    Encoder_DeltaBase += Position - Encoder_Position;
+    Encoder_Position = Position;
+}
+
+/**
+ * @brief  获取自上次调用以来转过的计数
+ * @retval 计数增量，正负表示方向
+ */
+int32_t Encoder_GetDelta(void)
+{
+    int32_t Delta;
+
+    Encoder_Sync();
+    Delta = Encoder_Position - Encoder_DeltaBase;
+    Encoder_DeltaBase = Encoder_Position;
+    return Delta;
+}
+
+/**
+ * @brief  获取转速
+ * @retval 计数/秒，正负表示方向，每 ENCODER_VEL_PERIOD 毫秒更新一次
+ */
+int32_t Encoder_GetVelocity(void)
+{
+    return Encoder_Velocity;
+}
+
+/**
+ * @brief  速度采样
+ * @note   在 1ms 定时中断中调用，每 ENCODER_VEL_PERIOD 次读一次计数器。
+ */
+void Encoder_Tick(void)
+{
+    static uint16_t Count = 0;
+    static uint16_t Last = 0;
+    uint16_t Now;
+
+    if (++Count < ENCODER_VEL_PERIOD)
+        return;
+    Count = 0;
+
+    Now = TIM_GetCounter(TIM3);
+    Encoder_Velocity = (int32_t)(int16_t)(Now - Last) * (1000 / ENCODER_VEL_PERIOD);
+    Last = Now;
+}
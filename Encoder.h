@@ -0,0 +1,42 @@
+/**
+ ******************************************************************************
+ * @file    Encoder.h
+ * @brief   TIM3 正交编码器接口头文件
+ * @note    本模块默认使用 TIM3_CH1 (PA6) 与 TIM3_CH2 (PA7) 接编码器 A、B 相。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 计数完全由 TIM3 编码器模式完成（TI1、TI2 双边沿，4 倍频），不占用 CPU；
+ * - 硬件计数器只有 16 位，Encoder_GetPosition() / Encoder_GetDelta() 在读取时
+ *   把增量累加到 32 位位置，两次读取之间转过的计数不能超过 32767；
+ * - 速度由 Encoder_Tick() 每 ENCODER_VEL_PERIOD 毫秒采样一次，需在 1ms 定时中断中调用
+ *   （在 Key_Full.h 中定义 KEY_ENCODER 后由 Key_Tick() 自动调用）。
+ ******************************************************************************
+ */
+
+#ifndef __ENCODER_H
+#define __ENCODER_H
+
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ENCODER_FILTER          0x0F    ///< 输入滤波（0x0~0xF），0xF 约为 3.5us
+#define ENCODER_VEL_PERIOD      50      ///< 速度采样周期（ms）
+
+void Encoder_Init(void);
+int32_t Encoder_GetPosition(void);
+void Encoder_SetPosition(int32_t Position);
+int32_t Encoder_GetDelta(void);
+int32_t Encoder_GetVelocity(void);
+void Encoder_Tick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ENCODER_H */
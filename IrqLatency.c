@@ -0,0 +1,235 @@
+/**
+ ******************************************************************************
+ * @file    IrqLatency.c
+ * @brief   中断响应延迟与执行时间测量
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 中断服务函数入口调用 IrqLatency_Enter()：读 CYCCNT，确定触发时刻并算出延迟；
+ * 出口调用 IrqLatency_Exit()：算出执行时间并更新统计。两处都只有比较与 CLZ，
+ * 没有除法。同一中断不会自身嵌套，因此每个编号只需一组暂存量；
+ * 不同中断之间可以抢占，各自的统计互不干扰。
+ *
+ * 测得的执行时间包含 IrqLatency_Exit() 之前插桩本身的开销（约几十个周期），
+ * 比较不同优先级配置时这部分是相同的。
+ *
+ * 依赖：
+ * - stm32f10x.h
+ * - MyDWT.h
+ * - IrqLatency.h
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include "stm32f10x.h"                  // Device header
+#include "MyDWT.h"
+#include "IrqLatency.h"
+
+#define IRQLAT_UNKNOWN      0xFFFFFFFF  ///< 触发时刻未知
+
+/**
+ * @brief 单个中断的测量状态
+ */
+typedef struct {
+	TIM_TypeDef *Timer;             ///< 关联的定时器，用于反推触发时刻
+	volatile uint8_t Armed;         ///< 是否有软件触发时间戳
+	volatile uint32_t Stamp;        ///< 软件触发时刻
+	uint32_t Entry;                 ///< 本次进入时刻
+	uint32_t Latency;               ///< 本次延迟
+	IrqLatency_Stats_t Stats;       ///< 统计结果
+} IrqLatency_Slot_t;
+
+static IrqLatency_Slot_t IrqLatency_Slots[IRQLAT_COUNT];
+
+static const char *const IrqLatency_Names[IRQLAT_COUNT] = {
+	"TIM1", "TIM2", "EXTI0", "EXTI1", "EXTI2", "EXTI3", "EXTI4", "EXTI9", "EXTI15"
+};
+
+/**
+ * @brief  初始化：启动 DWT 并清空统计
+ */
+void IrqLatency_Init(void){
+	MyDWT_Init();
+	IrqLatency_Reset();
+}
+
+/**
+ * @brief  关联向上计数的定时器，进入中断时由计数值反推更新事件时刻
+ * @param  Id   中断编号 (IRQLAT_xxx)
+ * @param  TIMx 定时器，NULL 取消关联
+ * @note   更新事件发生时 CNT 归零，进入中断时 CNT×(PSC+1) 即已过去的周期数，
+ *         要求定时器时钟等于内核时钟（APB 分频为 1 或 TIM 时钟倍频后相等）。
+ */
+void IrqLatency_AttachTimer(uint8_t Id, TIM_TypeDef *TIMx){
+	if(Id < IRQLAT_COUNT){
+		IrqLatency_Slots[Id].Timer = TIMx;
+	}
+}
+
+/**
+ * @brief  软件触发 NVIC 中断并记录触发时刻
+ * @param  Id   中断编号 (IRQLAT_xxx)
+ * @param  IRQn 中断号
+ * @note   只置 NVIC 挂起位，外设标志不变，适合测量空跑的响应延迟。
+ */
+void IrqLatency_TriggerIRQ(uint8_t Id, IRQn_Type IRQn){
+	IrqLatency_Slot_t *Slot;
+	
+	if(Id >= IRQLAT_COUNT){
+		return;
+	}
+	Slot = &IrqLatency_Slots[Id];
+	Slot->Stamp = MyDWT_GetCycles();
+	Slot->Armed = 1;
+	NVIC->ISPR[IRQn >> 5] = 1UL << (IRQn & 0x1F);
+}
+
+/**
+ * @brief  通过 EXTI 软件中断事件寄存器触发线路并记录触发时刻
+ * @param  Id   中断编号 (IRQLAT_xxx)
+ * @param  Line EXTI 线路 (0~15)，需已由 EXTI_Register() 注册
+ * @note   与引脚边沿走相同的路径（置 PR 位、进入回调），可测得含分发在内的完整响应。
+ */
+void IrqLatency_TriggerEXTI(uint8_t Id, uint8_t Line){
+	IrqLatency_Slot_t *Slot;
+	
+	if(Id >= IRQLAT_COUNT){
+		return;
+	}
+	Slot = &IrqLatency_Slots[Id];
+	Slot->Stamp = MyDWT_GetCycles();
+	Slot->Armed = 1;
+	EXTI->SWIER = 1UL << Line;
+}
+
+/**
+ * @brief  中断入口：记录进入时刻并计算延迟
+ * @param  Id 中断编号 (IRQLAT_xxx)
+ */
+void IrqLatency_Enter(uint8_t Id){
+	uint32_t Now = MyDWT_GetCycles();
+	IrqLatency_Slot_t *Slot = &IrqLatency_Slots[Id];
+	
+	Slot->Entry = Now;
+	if(Slot->Armed){
+		Slot->Armed = 0;
+		Slot->Latency = Now - Slot->Stamp;
+	}else if(Slot->Timer){
+		Slot->Latency = Slot->Timer->CNT * (Slot->Timer->PSC + 1);
+	}else{
+		Slot->Latency = IRQLAT_UNKNOWN;
+	}
+}
+
+/**
+ * @brief  中断出口：计算执行时间并更新统计
+ * @param  Id 中断编号 (IRQLAT_xxx)
+ */
+void IrqLatency_Exit(uint8_t Id){
+	IrqLatency_Slot_t *Slot = &IrqLatency_Slots[Id];
+	IrqLatency_Stats_t *Stats = &Slot->Stats;
+	uint32_t Exec = MyDWT_GetCycles() - Slot->Entry;
+	uint32_t Latency = Slot->Latency;
+	uint8_t Bin;
+	
+	Stats->Count++;
+	if(Exec < Stats->ExecMin)	{Stats->ExecMin = Exec;}
+	if(Exec > Stats->ExecMax)	{Stats->ExecMax = Exec;}
+	
+	if(Latency == IRQLAT_UNKNOWN){
+		return;
+	}
+	Stats->Measured++;
+	if(Latency < Stats->LatMin)	{Stats->LatMin = Latency;}
+	if(Latency > Stats->LatMax)	{Stats->LatMax = Latency;}
+	
+	Bin = 32 - __CLZ(Latency);          // 0 -> 0，[2^(n-1), 2^n) -> n
+	if(Bin >= IRQLAT_BINS){
+		Bin = IRQLAT_BINS - 1;
+	}
+	Stats->Hist[Bin]++;
+}
+
+/**
+ * @brief  读取统计
+ * @param  Id    中断编号 (IRQLAT_xxx)
+ * @param  Stats 输出，尚无数据时最小值为 0
+ */
+void IrqLatency_GetStats(uint8_t Id, IrqLatency_Stats_t *Stats){
+	if(Id >= IRQLAT_COUNT){
+		return;
+	}
+	__disable_irq();
+	*Stats = IrqLatency_Slots[Id].Stats;
+	__enable_irq();
+	
+	if(Stats->Count == 0)		{Stats->ExecMin = 0;}
+	if(Stats->Measured == 0)	{Stats->LatMin = 0;}
+}
+
+/**
+ * @brief  清空全部统计（关联的定时器保留）
+ */
+void IrqLatency_Reset(void){
+	uint8_t i, j;
+	
+	__disable_irq();
+	for(i = 0; i < IRQLAT_COUNT; i++){
+		IrqLatency_Stats_t *Stats = &IrqLatency_Slots[i].Stats;
+		
+		IrqLatency_Slots[i].Armed = 0;
+		Stats->Count = 0;
+		Stats->Measured = 0;
+		Stats->LatMin = 0xFFFFFFFF;
+		Stats->LatMax = 0;
+		Stats->ExecMin = 0xFFFFFFFF;
+		Stats->ExecMax = 0;
+		for(j = 0; j < IRQLAT_BINS; j++){
+			Stats->Hist[j] = 0;
+		}
+	}
+	__enable_irq();
+}
+
+/**
+ * @brief  逐行输出统计，跳过尚未进入过的中断
+ * @param  Print 行输出函数（如 OLED 按行显示或串口发送），行内不含换行符
+ * @note   每个中断输出两行（单位：周期）：
+ *         "TIM2   L:12-340 X:120"  延迟最小-最大，最长执行时间；
+ *         " H:0 3 12 40 ..."        延迟直方图，从第 0 桶到最后一个非空桶。
+ */
+void IrqLatency_Report(void (*Print)(const char *Line)){
+	IrqLatency_Stats_t Stats;
+	char Line[64];
+	uint8_t i, j, Last;
+	int Len;
+	
+	for(i = 0; i < IRQLAT_COUNT; i++){
+		IrqLatency_GetStats(i, &Stats);
+		if(Stats.Count == 0){
+			continue;
+		}
+		if(Stats.Measured){
+			sprintf(Line, "%-7sL:%lu-%lu X:%lu", IrqLatency_Names[i],
+					(unsigned long)Stats.LatMin, (unsigned long)Stats.LatMax, (unsigned long)Stats.ExecMax);
+		}else{
+			sprintf(Line, "%-7sL:-- X:%lu", IrqLatency_Names[i], (unsigned long)Stats.ExecMax);
+		}
+		Print(Line);
+		
+		if(Stats.Measured == 0){
+			continue;
+		}
+		Last = 0;
+		for(j = 0; j < IRQLAT_BINS; j++){
+			if(Stats.Hist[j])	{Last = j;}
+		}
+		Len = sprintf(Line, " H:");
+		for(j = 0; j <= Last && Len < (int)sizeof(Line) - 12; j++){
+			Len += sprintf(Line + Len, "%lu ", (unsigned long)Stats.Hist[j]);
+		}
+		Print(Line);
+	}
+}
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file    IrqLatency.h
+ * @brief   中断响应延迟与执行时间测量头文件
+ * @note    声明插桩宏、触发/统计/报告函数接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 打开 IRQ_LATENCY 后，各中断服务函数首尾的 IRQ_LATENCY_ENTER/EXIT 才会生效，
+ *   关闭时两个宏为空，不产生任何代码；
+ * - 延迟 = 进入中断时刻 - 硬件触发时刻，执行时间 = 退出时刻 - 进入时刻，单位为 CPU 周期；
+ * - 触发时刻的来源（按优先级）：
+ *   1. IrqLatency_TriggerIRQ()/IrqLatency_TriggerEXTI() 软件触发前记录的时间戳；
+ *   2. IrqLatency_AttachTimer() 关联的向上计数定时器，由进入时的 CNT×(PSC+1) 反推，
+ *      分辨率为 PSC+1 个周期；
+ *   3. 以上都没有时（如外部引脚边沿），只统计执行时间。
+ ******************************************************************************
+ */
+
+#ifndef __IRQLATENCY_H
+#define __IRQLATENCY_H
+
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+//#define IRQ_LATENCY                 ///< 打开中断延迟测量（插桩）
+
+#define IRQLAT_BINS         12      ///< 延迟直方图桶数，第 n 桶为 [2^(n-1), 2^n) 周期，末桶包含更大值
+
+/* 中断编号 -----------------------------------------------------------------*/
+#define IRQLAT_TIM1_UP      0
+#define IRQLAT_TIM2         1
+#define IRQLAT_EXTI0        2
+#define IRQLAT_EXTI1        3
+#define IRQLAT_EXTI2        4
+#define IRQLAT_EXTI3        5
+#define IRQLAT_EXTI4        6
+#define IRQLAT_EXTI9_5      7
+#define IRQLAT_EXTI15_10    8
+#define IRQLAT_COUNT        9
+
+/* 插桩宏 -------------------------------------------------------------------*/
+#ifdef IRQ_LATENCY
+#define IRQ_LATENCY_ENTER(Id)   IrqLatency_Enter(Id)
+#define IRQ_LATENCY_EXIT(Id)    IrqLatency_Exit(Id)
+#else
+#define IRQ_LATENCY_ENTER(Id)
+#define IRQ_LATENCY_EXIT(Id)
+#endif
+
+/**
+ * @brief 单个中断的统计（单位：CPU 周期）
+ */
+typedef struct {
+	uint32_t Count;                 ///< 进入次数
+	uint32_t Measured;              ///< 已知触发时刻、计入延迟统计的次数
+	uint32_t LatMin;                ///< 最小延迟
+	uint32_t LatMax;                ///< 最大延迟
+	uint32_t ExecMin;               ///< 最短执行时间
+	uint32_t ExecMax;               ///< 最长执行时间
+	uint32_t Hist[IRQLAT_BINS];     ///< 延迟直方图（按 2 的幂分桶）
+} IrqLatency_Stats_t;
+
+/* 函数声明 -----------------------------------------------------------------*/
+void IrqLatency_Init(void);
+void IrqLatency_AttachTimer(uint8_t Id, TIM_TypeDef *TIMx);
+void IrqLatency_TriggerIRQ(uint8_t Id, IRQn_Type IRQn);
+void IrqLatency_TriggerEXTI(uint8_t Id, uint8_t Line);
+void IrqLatency_Enter(uint8_t Id);
+void IrqLatency_Exit(uint8_t Id);
+void IrqLatency_GetStats(uint8_t Id, IrqLatency_Stats_t *Stats);
+void IrqLatency_Reset(void);
+void IrqLatency_Report(void (*Print)(const char *Line));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IRQLATENCY_H */
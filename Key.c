@@ -7,22 +7,37 @@
  * @author  Jeffrey
  ******************************************************************************
  * @attention
- * 本模块使用 TIM1 定时器实现周期性按键扫描与防抖处理。
+ * 本模块使用 TIM1 定时器实现周期性按键采样，并用垂直计数器（Debounce.c）
+ * 对 GPIOA 的所有按键引脚同时消抖。
  * 按键默认连接至 GPIOA 引脚 (PA2, PA3)，采用上拉输入模式。
  *
  * 若要扩展更多按键，可在 Key_GetState() 中增加引脚检测逻辑。
+ *
+ * 按键松开时在中断中把事件（按键号、时刻）写入 KeyEvent 队列，
+ * Key_GetNum() 从队列中依次取出，主循环繁忙时按键不会丢失或合并。
  ******************************************************************************
  */
 
 #include "stm32f10x.h"                  // Device header
 #include "GPIO_Init.h"
+#include "Key.h"
+#include "KeyEvent.h"
+#include "Debounce.h"
+
+#define KEY_PINS        (GPIO_Pin_2 | GPIO_Pin_3)  /**< 按键引脚（GPIOA，低电平按下） */
+#define KEY_TIME_SAMPLE 5                          /**< 采样周期（ms） */
+
 
+/** 
+ * @brief  毫秒计数，作为事件时间戳
+ * @note   该变量在 Key_Tick() 内部递增。
+ */
+static uint32_t Key_Time = 0;
 
 /** 
- * @brief  当前检测到的按键编号
- * @note   该变量在 Key_Tick() 内部设置，在 Key_GetNum() 中读取并清零。
+ * @brief  GPIOA 按键引脚的消抖状态
  */
-uint8_t Key_Num = 0;
+static Debounce_t Key_Debounce;
 
 
 /**
@@ -33,7 +48,8 @@ uint8_t Key_Num = 0;
 void Key_Init(void){
 	
 	// GPIO Init
-	GPIOA_Init(GPIO_Mode_IPU, GPIO_Pin_2 | GPIO_Pin_3);
+	GPIOA_Init(GPIO_Mode_IPU, KEY_PINS);
+	Debounce_Init(&Key_Debounce, 0);
 	
 	RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM1, ENABLE);
 	
@@ -68,14 +84,12 @@ void Key_Init(void){
 /**
  * @brief  获取按键编号
  * @retval 若有新按键事件返回按键号 (1, 2, ...)，否则返回 0。
- * @note   每次调用后 Key_Num 会被清零。
+ * @note   每次调用从事件队列中取出一个事件。
  */
 uint8_t Key_GetNum(void){
-	uint8_t Tmp = 0;
-	if(Key_Num){
-		Tmp = Key_Num;
-		Key_Num = 0;
-		return Tmp;
+	KeyEvent_t Event;
+	if(KeyEvent_Pop(&Event)){
+		return Event.Key;
 	}
 	return 0;
 }
@@ -101,20 +115,25 @@ uint8_t Key_GetState(void){
 
 /**
  * @brief  定时扫描函数
- * @note   应在 TIM1 中断或定时任务中周期调用。
- *         每约 20 次计数检测一次按键状态，用于消抖与事件识别。
+ * @note   应在 TIM1 中断或定时任务中每 1ms 调用一次。
+ *         每 KEY_TIME_SAMPLE 次计数采样一次，两个按键同时消抖，
+ *         按键松开时把按键号写入事件队列。
  */
 void Key_Tick(void){
 	static uint8_t Count = 0;
-	static uint8_t CurrentState, PrevState;
 	
-	if(Count >= 20){
+	Key_Time++;
+	if(Count >= KEY_TIME_SAMPLE){
 		Count = 0;
 		
-		PrevState = CurrentState;
-		CurrentState = Key_GetState();
-		if(PrevState != 0 && CurrentState == 0){
-			Key_Num = PrevState;
+		// 低电平按下，取反后 1 表示按下
+		if(Debounce_Update(&Key_Debounce, ~GPIOA->IDR & KEY_PINS)){
+			if(Key_Debounce.Released & GPIO_Pin_2){
+				KeyEvent_Push(1, KEY_EVENT_CLICK, 1, Key_Time);
+			}
+			if(Key_Debounce.Released & GPIO_Pin_3){
+				KeyEvent_Push(2, KEY_EVENT_CLICK, 1, Key_Time);
+			}
 		}
 	}
 	Count ++;
@@ -7,22 +7,28 @@
  * @author  Jeffrey
  ******************************************************************************
  * @attention
- * 本模块使用 GPIOA (PA2、PA3) 作为输入引脚，并支持定时扫描防抖。
+ * 本模块使用 GPIOA (PA2、PA3) 作为输入引脚，并支持定时采样消抖。
  * 若启用定时中断，请确保在主循环或定时器中周期调用 Key_Tick()。
  *
  * 依赖：
  * - stm32f10x.h
  * - GPIO_Init.h
+ * - KeyEvent.h
+ * - Debounce.h
  ******************************************************************************
  */
 
 #ifndef __KEY_H
 #define __KEY_H
 
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define KEY_EVENT_CLICK     1   ///< 事件队列中的事件类型：按下并松开
+
 
 void Key_Init(void);
 uint8_t Key_GetNum(void);
@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file    KeyEvent.c
+ * @brief   按键事件队列（单生产者 / 单消费者无锁环形缓冲）
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * Head 只由生产者（中断）修改，Tail 只由消费者（主循环）修改，
+ * 两个索引都是自由递增的 8 位计数，使用时再与 KEYEVENT_SIZE - 1 相与，
+ * (Head - Tail) 即为队列中的事件数。单核 Cortex-M3 上对 8 位变量的读写
+ * 是原子的，因此入队、出队都不需要关中断。
+ *
+ * 先写数据再发布索引：__DMB() 保证事件内容在 Head 更新之前写完，
+ * 消费者同样在读完事件后才更新 Tail。
+ *
+ * 依赖：
+ * - stm32f10x.h
+ * - KeyEvent.h
+ ******************************************************************************
+ */
+
+#include "stm32f10x.h"                  // Device header
+#include "KeyEvent.h"
+
+#define KEYEVENT_MASK       (KEYEVENT_SIZE - 1)
+
+static KeyEvent_t KeyEvent_Buf[KEYEVENT_SIZE];
+static volatile uint8_t KeyEvent_Head;      ///< 下一个写入位置（生产者）
+static volatile uint8_t KeyEvent_Tail;      ///< 下一个读取位置（消费者）
+static KeyEvent_Stats_t KeyEvent_Stats;     ///< 统计（生产者）
+
+/**
+ * @brief  事件入队（生产者调用，通常在中断中）
+ * @param  Key   按键编号
+ * @param  Event 事件类型
+ * @param  Count 附加计数
+ * @param  Tick  事件发生时刻
+ * @retval 1：入队成功
+ * @retval 0：队列已满，事件被丢弃并计入 Dropped
+ */
+uint8_t KeyEvent_Push(uint8_t Key, uint8_t Event, uint8_t Count, uint32_t Tick){
+	uint8_t Head = KeyEvent_Head;
+	uint8_t Used = Head - KeyEvent_Tail;
+	KeyEvent_t *Slot;
+	
+	if(Used >= KEYEVENT_SIZE){
+		KeyEvent_Stats.Dropped++;
+		return 0;
+	}
+	
+	Slot = &KeyEvent_Buf[Head & KEYEVENT_MASK];
+	Slot->Key = Key;
+	Slot->Event = Event;
+	Slot->Count = Count;
+	Slot->Tick = Tick;
+	__DMB();
+	KeyEvent_Head = Head + 1;
+	
+	KeyEvent_Stats.Pushed++;
+	if(Used + 1 > KeyEvent_Stats.MaxUsed){
+		KeyEvent_Stats.MaxUsed = Used + 1;
+	}
+	return 1;
+}
+
+/**
+ * @brief  事件出队（消费者调用，通常在主循环中）
+ * @param  Event 接收事件的结构体
+ * @retval 1：取到一个事件
+ * @retval 0：队列为空
+ */
+uint8_t KeyEvent_Pop(KeyEvent_t *Event){
+	uint8_t Tail = KeyEvent_Tail;
+	
+	if(Tail == KeyEvent_Head){
+		return 0;
+	}
+	__DMB();
+	*Event = KeyEvent_Buf[Tail & KEYEVENT_MASK];
+	__DMB();
+	KeyEvent_Tail = Tail + 1;
+	return 1;
+}
+
+/**
+ * @brief  获取队列中待处理的事件数
+ */
+uint8_t KeyEvent_Count(void){
+	return (uint8_t)(KeyEvent_Head - KeyEvent_Tail);
+}
+
+/**
+ * @brief  丢弃队列中所有待处理的事件（消费者调用）
+ */
+void KeyEvent_Flush(void){
+	KeyEvent_Tail = KeyEvent_Head;
+}
+
+/**
+ * @brief  读取队列统计
+ * @param  Stats 接收统计的结构体
+ * @note   统计只由生产者写入，读取期间若有事件入队，各字段可能相差一次。
+ */
+void KeyEvent_GetStats(KeyEvent_Stats_t *Stats){
+	*Stats = KeyEvent_Stats;
+}
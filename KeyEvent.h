@@ -0,0 +1,61 @@
+/**
+ ******************************************************************************
+ * @file    KeyEvent.h
+ * @brief   按键事件队列头文件（单生产者 / 单消费者环形缓冲）
+ * @note    声明事件结构体、队列统计结构体与入队、出队函数接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 生产者只能有一个（通常是 TIM1 中断中的 Key_Tick()），消费者只能有一个
+ *   （通常是主循环），两者之间无需关中断；
+ * - Key.c 与 Key_Full.c 都通过本队列上报事件，二者只能选用其一。
+ ******************************************************************************
+ */
+
+#ifndef __KEYEVENT_H
+#define __KEYEVENT_H
+
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+#ifndef KEYEVENT_SIZE
+#define KEYEVENT_SIZE       16  ///< 队列容量，必须为 2 的幂且不超过 128
+#endif
+
+/**
+ * @brief 按键事件
+ */
+typedef struct {
+	uint8_t Key;        ///< 按键编号（由生产者定义）
+	uint8_t Event;      ///< 事件类型（Key_Full 中为 KEY_DOWN、KEY_SINGLE 等）
+	uint8_t Count;      ///< 附加计数：单击 / 双击 / 多击为按下次数，连击为第几次，其余为 0
+	uint32_t Tick;      ///< 事件发生时刻（ms）
+} KeyEvent_t;
+
+/**
+ * @brief 队列统计（仅由生产者更新），用于评估 KEYEVENT_SIZE 是否足够
+ */
+typedef struct {
+	uint32_t Pushed;    ///< 成功入队的事件数
+	uint32_t Dropped;   ///< 队列满而丢弃的事件数
+	uint8_t MaxUsed;    ///< 队列中同时存在的最大事件数
+} KeyEvent_Stats_t;
+
+/* 函数声明 -----------------------------------------------------------------*/
+uint8_t KeyEvent_Push(uint8_t Key, uint8_t Event, uint8_t Count, uint32_t Tick);
+uint8_t KeyEvent_Pop(KeyEvent_t *Event);
+uint8_t KeyEvent_Count(void);
+void KeyEvent_Flush(void);
+void KeyEvent_GetStats(KeyEvent_Stats_t *Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __KEYEVENT_H */
@@ -0,0 +1,141 @@
+/**
+ ******************************************************************************
+ * @file    KeyMatrix.c
+ * @brief   矩阵键盘扫描驱动（4x4 / 4x8，鬼键检测）
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 扫描方式：
+ * - 依次把一行拉低（开漏输出，其余行为高阻），等待 KEYMATRIX_SETTLE 个空操作后
+ *   读一次列线端口的 IDR，即得到这一行所有按键的状态；
+ * - 每一行的列状态（第 c 位对应第 c 列）送入该行的 Debounce_t 同时消抖。
+ *
+ * 鬼键：没有二极管时，若一个矩形的三个角被按下，第四个角也会被读成按下，
+ * 读数上表现为两行有两列以上同时按下。检测到这种情况时丢弃本次采样、
+ * 保持原有稳定状态，并计入 KeyMatrix_GetGhosts()。每个按键都串有二极管时
+ * 定义 KEYMATRIX_DIODES，不做此检测，任意多个按键可以同时按下。
+ *
+ * 依赖：
+ * - stm32f10x.h
+ * - Debounce.h
+ * - KeyMatrix.h
+ ******************************************************************************
+ */
+
+#include "stm32f10x.h"                  // Device header
+#include "Debounce.h"
+#include "KeyMatrix.h"
+
+#define KEYMATRIX_ROW_MASK      (((1UL << KEYMATRIX_ROWS) - 1) << KEYMATRIX_ROW_PIN0)
+#define KEYMATRIX_COL_MASK      ((1UL << KEYMATRIX_COLS) - 1)
+
+static Debounce_t KeyMatrix_Rows[KEYMATRIX_ROWS];   ///< 各行消抖状态
+static uint32_t KeyMatrix_Ghosts;                   ///< 因鬼键丢弃的采样次数
+
+/**
+ * @brief  根据端口地址开启 GPIO 时钟
+ */
+static void KeyMatrix_ClockCmd(GPIO_TypeDef *Port){
+	// GPIOA、GPIOB ... 的地址与 RCC 时钟位都是等间隔排列的
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA << (((uint32_t)Port - GPIOA_BASE) >> 10), ENABLE);
+}
+
+/**
+ * @brief  初始化矩阵键盘引脚与消抖状态
+ * @note   行线开漏输出并全部释放（高阻），列线上拉输入。
+ */
+void KeyMatrix_Init(void){
+	uint8_t r;
+	GPIO_InitTypeDef GPIO_InitStructure;
+	
+	KeyMatrix_ClockCmd(KEYMATRIX_ROW_PORT);
+	KeyMatrix_ClockCmd(KEYMATRIX_COL_PORT);
+	
+	KEYMATRIX_ROW_PORT->BSRR = KEYMATRIX_ROW_MASK;
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_OD;
+	GPIO_InitStructure.GPIO_Pin = KEYMATRIX_ROW_MASK;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_Init(KEYMATRIX_ROW_PORT, &GPIO_InitStructure);
+	
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;
+	GPIO_InitStructure.GPIO_Pin = KEYMATRIX_COL_MASK << KEYMATRIX_COL_PIN0;
+	GPIO_Init(KEYMATRIX_COL_PORT, &GPIO_InitStructure);
+	
+	for(r = 0; r < KEYMATRIX_ROWS; r++){
+		Debounce_Init(&KeyMatrix_Rows[r], 0);
+	}
+	KeyMatrix_Ghosts = 0;
+}
+
+#ifndef KEYMATRIX_DIODES
+/**
+ * @brief  丢弃本次采样：稳定状态保持不变，边沿清零
+ */
+static void KeyMatrix_Discard(void){
+	uint8_t r;
+	
+	KeyMatrix_Ghosts++;
+	for(r = 0; r < KEYMATRIX_ROWS; r++){
+		KeyMatrix_Rows[r].Pressed = 0;
+		KeyMatrix_Rows[r].Released = 0;
+	}
+}
+#endif
+
+/**
+ * @brief  扫描整个矩阵一次并消抖
+ * @retval 0：采样有效，各行消抖状态已更新
+ * @retval 1：检测到鬼键，本次采样被丢弃
+ * @note   每行只读一次列线端口；更新后各行的 Pressed / Released 为本次的边沿，
+ *         丢弃采样时边沿清零。
+ */
+uint8_t KeyMatrix_Scan(void){
+	uint16_t Raw[KEYMATRIX_ROWS];
+	uint8_t r, i;
+	
+	for(r = 0; r < KEYMATRIX_ROWS; r++){
+		KEYMATRIX_ROW_PORT->BRR = 1 << (KEYMATRIX_ROW_PIN0 + r);
+		for(i = 0; i < KEYMATRIX_SETTLE; i++){
+			__NOP();
+		}
+		Raw[r] = (~KEYMATRIX_COL_PORT->IDR >> KEYMATRIX_COL_PIN0) & KEYMATRIX_COL_MASK;
+		KEYMATRIX_ROW_PORT->BSRR = 1 << (KEYMATRIX_ROW_PIN0 + r);
+	}
+	
+#ifndef KEYMATRIX_DIODES
+	// 任意两行有两列以上同时按下：无法区分真实按键与鬼键
+	uint16_t Common;
+	for(r = 1; r < KEYMATRIX_ROWS; r++){
+		for(i = 0; i < r; i++){
+			Common = Raw[r] & Raw[i];
+			if(Common & (Common - 1)){
+				KeyMatrix_Discard();
+				return 1;
+			}
+		}
+	}
+#endif
+	
+	for(r = 0; r < KEYMATRIX_ROWS; r++){
+		Debounce_Update(&KeyMatrix_Rows[r], Raw[r]);
+	}
+	return 0;
+}
+
+/**
+ * @brief  获取一行的消抖状态
+ * @param  Row 行号（0 ~ KEYMATRIX_ROWS-1）
+ * @retval 该行的 Debounce_t：State 为稳定按下的列，Pressed / Released 为最近一次扫描的边沿
+ */
+const Debounce_t *KeyMatrix_GetRow(uint8_t Row){
+	return &KeyMatrix_Rows[Row];
+}
+
+/**
+ * @brief  获取因鬼键而丢弃的采样次数
+ */
+uint32_t KeyMatrix_GetGhosts(void){
+	return KeyMatrix_Ghosts;
+}
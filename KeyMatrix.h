@@ -0,0 +1,52 @@
+/**
+ ******************************************************************************
+ * @file    KeyMatrix.h
+ * @brief   矩阵键盘扫描驱动头文件
+ * @note    声明矩阵键盘引脚配置与初始化、扫描、状态读取函数接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 行线为开漏输出，列线为上拉输入，按键接在行线与列线之间；
+ * - 行线、列线各自必须是同一端口上连续的引脚；
+ * - 一般不单独使用：在 Key_Full.h 中定义 KEY_MATRIX 后，由 Key_Tick() 调用
+ *   KeyMatrix_Scan()，矩阵按键获得与直连按键相同的单击、双击、长按、连击事件；
+ * - 每个按键都串有二极管时定义 KEYMATRIX_DIODES，关闭鬼键检测，支持任意多键同时按下。
+ ******************************************************************************
+ */
+
+#ifndef __KEYMATRIX_H
+#define __KEYMATRIX_H
+
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+#include "Debounce.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+#define KEYMATRIX_ROWS          4           ///< 行数（1~16）
+#define KEYMATRIX_COLS          4           ///< 列数（1~16），4x8 键盘改为 8
+
+#define KEYMATRIX_ROW_PORT      GPIOB       ///< 行线端口
+#define KEYMATRIX_ROW_PIN0      12          ///< 第 0 行引脚号，默认 PB12~PB15
+#define KEYMATRIX_COL_PORT      GPIOA       ///< 列线端口
+#define KEYMATRIX_COL_PIN0      8           ///< 第 0 列引脚号，默认 PA8~PA11
+
+#define KEYMATRIX_SETTLE        8           ///< 驱动行线后等待列线稳定的空操作次数
+
+//#define KEYMATRIX_DIODES      ///< 每个按键都串有二极管：关闭鬼键检测
+
+/* 函数声明 -----------------------------------------------------------------*/
+void KeyMatrix_Init(void);
+uint8_t KeyMatrix_Scan(void);
+const Debounce_t *KeyMatrix_GetRow(uint8_t Row);
+uint32_t KeyMatrix_GetGhosts(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __KEYMATRIX_H */
@@ -10,52 +10,191 @@
  * 本文件实现基于 STM32F10x 的多功能按键扫描逻辑，支持：
  * - 单击（SINGLE）
  * - 双击（DOUBLE）
+ * - 三击及以上（MULTI）
  * - 长按（LONG）
- * - 连续按下（REPEAT）
+ * - 连续按下（REPEAT，可逐渐加速）
  * - 按下（DOWN）
  * - 松开（UP）
  * - 按住状态（HOLD）
  *
+ * 按键由 Key_Table 描述表配置（端口、引脚、有效电平、初始时间参数），
+ * 时间参数复制到每个按键的运行状态中，可用 Key_SetTiming() 随时修改；
+ * 所有计时都以 Key_Time（1ms）为基准记录截止时刻，不做除法。
  * 默认使用 GPIOA 的 PA2、PA3 引脚作为输入按键，
- * 采用定时器 TIM1 进行周期扫描与防抖。
+ * 采用定时器 TIM1 进行周期采样与消抖。
+ *
+ * 每次采样对每个用到的端口只读一次 IDR，用垂直计数器（Debounce.c）
+ * 对整个端口同时消抖，再把稳定状态的变化按位分发给各按键；
+ * 只有稳定状态变化或正在计时的按键才会进入状态机，
+ * 因此空闲时的中断耗时与按键数量基本无关。
+ *
+ * 定义 KEY_WAKE_EXTI 后，按键全部松开且状态机空闲时停止 TIM1 并使能按键引脚的
+ * EXTI 下降沿中断，第一次按下由 Key_Wake() 重新启动 TIM1 扫描，空闲时每秒可省去
+ * 约 1000 次中断，主循环可以 __WFI() 休眠。停止期间 Key_Time 不计时。
+ *
+ * 定义 KEY_MATRIX 后每次采样还会扫描一次矩阵键盘（KeyMatrix.c），每行的消抖结果
+ * 按同样的方式分发，矩阵按键使用默认的各项时间。
+ *
+ * 定义 KEY_ENCODER 后编码器按键作为普通直连按键加入 Key_Table，旋转计数由 TIM3 硬件完成。
+ *
+ * 事件有两种读取方式：
+ * - `Key_Check()`：按位标志，每种事件只保留一个，主循环繁忙时会合并丢失；
+ * - `KeyEvent_Pop()`：带时间戳的事件队列（见 KeyEvent.h），不会合并，
+ *   队列满时计入溢出统计。
  *
  * 建议在 TIM1 定时中断或主循环中周期调用 `Key_Tick()`。
  *
  * 依赖：
  * - stm32f10x.h
- * - GPIO_Init.h
  * - Key_Full.h
+ * - KeyEvent.h
+ * - Debounce.h
+ * - EXTI_Init.h（定义 KEY_WAKE_EXTI 时）
+ * - KeyMatrix.h（定义 KEY_MATRIX 时）
+ * - Encoder.h（定义 KEY_ENCODER 时）
  ******************************************************************************
  */
 
 #include "stm32f10x.h"                  // Device header
-#include "GPIO_Init.h"
 #include "Key_Full.h"
+#include "KeyEvent.h"
+#include "Debounce.h"
+#ifdef KEY_WAKE_EXTI
+#include "EXTI_Init.h"
+#endif
 
 /* 定义按键状态常量 */
 #define KEY_PRESSED       1     /**< 按键按下状态 */
 #define KEY_UNPRESSED     0     /**< 按键未按下状态 */
 
-/* 定义各种按键时间参数（单位：ms） */
-#define KEY_TIME_LONG     2000  /**< 长按判定时间 */
-#define KEY_TIME_DOUBLE   200   /**< 双击间隔时间 */
-#define KEY_TIME_REPEAT   100   /**< 长按连击间隔时间 */
+#define KEY_TIME_SAMPLE   5     /**< 采样周期（ms），消抖时间为 DEBOUNCE_SAMPLES 倍 */
+
+#define KEY_PORT_MAX      3     /**< 按键最多分布的端口数 */
+
+/**
+ * @brief 默认时间参数：长按 2s，多击间隔 200ms，每 100ms 连击一次，只识别到双击
+ */
+static const Key_Timing_t Key_DefaultTiming = {2000, 200, 100, 100, 0, 2};
+
+/**
+ * @brief 按键描述表，顺序与 Key_Full.h 中的按键编号一致（按需修改）
+ */
+static const Key_Desc_t Key_Table[KEY_COUNT] = {
+	{GPIOA, GPIO_Pin_2, 0, 0},
+	{GPIOA, GPIO_Pin_3, 0, 0},
+#ifdef KEY_ENCODER
+	{GPIOA, GPIO_Pin_5, 0, 0},
+#endif
+};
+
+/**
+ * @brief 单个按键的运行状态
+ */
+typedef struct {
+	uint8_t State;          ///< 状态机状态
+	uint8_t Flag;           ///< 事件标志（KEY_HOLD、KEY_DOWN ...）
+	uint8_t Clicks;         ///< 本轮已按下的次数
+	uint8_t LastClicks;     ///< 最近一次上报的按下次数
+	uint8_t Repeats;        ///< 本次长按的连击次数（饱和于 255）
+	uint16_t Interval;      ///< 当前连击间隔
+	uint32_t Deadline;      ///< 当前计时的截止时刻（Key_Time）
+	Key_Timing_t Timing;    ///< 时间参数
+} Key_State_t;
+
+/**
+ * @brief 端口分组：同一端口上的按键共用一次 IDR 读取
+ */
+typedef struct {
+	GPIO_TypeDef *Port;     ///< GPIO 端口
+	uint16_t Mask;          ///< 本端口上按键占用的引脚
+	uint16_t Invert;        ///< 低电平有效的引脚（读数取反）
+	Debounce_t Debounce;    ///< 端口消抖状态（State 为稳定的按下引脚）
+	uint16_t Busy;          ///< 状态机正在计时的引脚
+	uint8_t Key[16];        ///< 引脚号 -> 按键编号
+} Key_Port_t;
+
+static Key_State_t Key_States[KEY_TOTAL];
+static Key_Port_t Key_Ports[KEY_PORT_MAX];
+static uint8_t Key_PortCount;
+static volatile uint32_t Key_Time;      ///< 毫秒计数，由 Key_Tick() 递增
+
+#ifdef KEY_MATRIX
+static uint16_t Key_MatrixBusy[KEYMATRIX_ROWS];    ///< 各行正在计时的列
+#endif
 
-/* 按键标志变量（位标志寄存） */
-uint8_t Key_Flag = 0;
+#ifdef KEY_WAKE_EXTI
+static uint16_t Key_ExtiMask;           ///< 按键占用的 EXTI 线
+static volatile uint8_t Key_Scanning;   ///< TIM1 扫描是否在运行
+static void Key_Sleep(void);
+static void Key_WakeCallback(void *Ctx);
+#endif
 
 /**
  * @brief  初始化按键与定时器
  * @note
- * - 配置 PA2 和 PA3 为上拉输入模式；
+ * - 按 Key_Table 配置各按键引脚（低电平有效为上拉输入，高电平有效为下拉输入），
+ *   并把按键按端口分组；
  * - 初始化 TIM1 产生周期中断；
  * - 启用 NVIC 对 TIM1 的中断响应；
  * - 开启定时器计数。
  */
 void Key_Init(void){
+	uint8_t i, p, Pin;
+	const Key_Desc_t *Desc;
 	
-	// GPIO 初始化
-	GPIOA_Init(GPIO_Mode_IPU, GPIO_Pin_2 | GPIO_Pin_3);
+	// 各按键的时间参数
+	for(i = 0; i < KEY_TOTAL; i++){
+		if(i < KEY_COUNT && Key_Table[i].Timing){
+			Key_States[i].Timing = *Key_Table[i].Timing;
+		}else{
+			Key_States[i].Timing = Key_DefaultTiming;
+		}
+	}
+	
+	// GPIO 初始化与端口分组
+	GPIO_InitTypeDef GPIO_InitStructure;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	Key_PortCount = 0;
+	for(i = 0; i < KEY_COUNT; i++){
+		Desc = &Key_Table[i];
+		
+		for(p = 0; p < Key_PortCount; p++){
+			if(Key_Ports[p].Port == Desc->Port){
+				break;
+			}
+		}
+		if(p == Key_PortCount){
+			if(p >= KEY_PORT_MAX){
+				continue;   // 端口数超过 KEY_PORT_MAX，忽略该按键
+			}
+			Key_Ports[p].Port = Desc->Port;
+			Key_Ports[p].Mask = 0;
+			Key_Ports[p].Invert = 0;
+			Key_Ports[p].Busy = 0;
+			Debounce_Init(&Key_Ports[p].Debounce, 0);
+			Key_PortCount++;
+		}
+		
+		for(Pin = 0; (Desc->Pin >> Pin) > 1; Pin++);
+		Key_Ports[p].Mask |= Desc->Pin;
+		if(Desc->ActiveLevel == 0){
+			Key_Ports[p].Invert |= Desc->Pin;
+		}
+		Key_Ports[p].Key[Pin] = i;
+		
+		// GPIOA、GPIOB ... 的地址与 RCC 时钟位都是等间隔排列的
+		RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA << (((uint32_t)Desc->Port - GPIOA_BASE) >> 10), ENABLE);
+		GPIO_InitStructure.GPIO_Mode = Desc->ActiveLevel ? GPIO_Mode_IPD : GPIO_Mode_IPU;
+		GPIO_InitStructure.GPIO_Pin = Desc->Pin;
+		GPIO_Init(Desc->Port, &GPIO_InitStructure);
+		
+#ifdef KEY_WAKE_EXTI
+		// 按键引脚同时作为 EXTI 下降沿唤醒源
+		if(EXTI_Register(Desc->Port, Pin, EXTI_Trigger_Falling, 2, Key_WakeCallback, 0) == 0){
+			Key_ExtiMask |= Desc->Pin;
+		}
+#endif
+	}
 	
 	RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM1, ENABLE);
 	
@@ -83,33 +222,113 @@ void Key_Init(void){
 	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
 	NVIC_Init(&NVIC_InitStructure);
 	
+#ifdef KEY_MATRIX
+	KeyMatrix_Init();
+#endif
+	
+#ifdef KEY_ENCODER
+	Encoder_Init();
+#endif
+	
+#ifdef KEY_WAKE_EXTI
+	// 先进入空闲状态，等待按键唤醒
+	Key_Scanning = 1;
+	Key_Sleep();
+#else
 	// 启动 TIM1
 	TIM_Cmd(TIM1, ENABLE);
+#endif
 }
 
+#ifdef KEY_WAKE_EXTI
+/**
+ * @brief  唤醒按键扫描
+ * @note   由按键引脚的 EXTI 回调调用，也可由应用主动调用：关闭按键 EXTI、清除挂起位，
+ *         并启动 TIM1 扫描，之后的按键状态全部由 Key_Tick() 采样得到。
+ */
+void Key_Wake(void){
+	EXTI->IMR &= ~Key_ExtiMask;
+	EXTI->PR = Key_ExtiMask;
+	if(!Key_Scanning){
+		Key_Scanning = 1;
+		TIM_SetCounter(TIM1, 0);
+		TIM_Cmd(TIM1, ENABLE);
+	}
+}
+
+/**
+ * @brief  按键引脚的 EXTI 回调
+ */
+static void Key_WakeCallback(void *Ctx){
+	(void)Ctx;
+	Key_Wake();
+}
+
+/**
+ * @brief  停止按键扫描并使能 EXTI 唤醒
+ * @note   使能 EXTI 之后再检查一次电平：使能之前已经按下的按键不会再产生边沿，
+ *         此时直接继续扫描。
+ */
+static void Key_Sleep(void){
+	uint8_t p;
+	
+	TIM_Cmd(TIM1, DISABLE);
+	Key_Scanning = 0;
+	EXTI->PR = Key_ExtiMask;
+	EXTI->IMR |= Key_ExtiMask;
+	
+	for(p = 0; p < Key_PortCount; p++){
+		if(((uint16_t)Key_Ports[p].Port->IDR ^ Key_Ports[p].Invert) & Key_Ports[p].Mask){
+			Key_Wake();
+			return;
+		}
+	}
+}
+
+/**
+ * @brief  查询 TIM1 扫描是否在运行
+ * @retval 1：有按键活动，正在扫描
+ * @retval 0：空闲，等待 EXTI 唤醒
+ */
+uint8_t Key_IsScanning(void){
+	return Key_Scanning;
+}
+#endif
+
 /**
  * @brief  获取当前按键状态
+ * @param  n 按键编号（KEY_1、KEY_2 ... 或 KEY_MATRIX_ID(Row, Col)）
  * @retval KEY_PRESSED：按键按下
  * @retval KEY_UNPRESSED：按键未按下
+ * @note   直连按键直接读引脚（未经防抖），矩阵按键返回消抖后的状态。
  */
-uint8_t Key_GetState(void){
-	if(GPIO_ReadInputDataBit(GPIOA, GPIO_Pin_2) == 0){
+uint8_t Key_GetState(uint8_t n){
+	if(n < KEY_COUNT && GPIO_ReadInputDataBit(Key_Table[n].Port, Key_Table[n].Pin) == Key_Table[n].ActiveLevel){
 		return KEY_PRESSED;
 	}
+#ifdef KEY_MATRIX
+	if(n >= KEY_COUNT && n < KEY_TOTAL){
+		n -= KEY_COUNT;
+		if(KeyMatrix_GetRow(n / KEYMATRIX_COLS)->State & (1 << (n % KEYMATRIX_COLS))){
+			return KEY_PRESSED;
+		}
+	}
+#endif
 	return KEY_UNPRESSED;
 }
 
 /**
  * @brief  检查特定按键事件是否发生
+ * @param  n    按键编号（KEY_1、KEY_2 ... 或 KEY_MATRIX_ID(Row, Col)）
  * @param  Flag 事件标志（如 KEY_DOWN、KEY_UP、KEY_SINGLE 等）
  * @retval 1：事件发生
  * @retval 0：事件未发生
  * @note 对于非持续状态事件（如 DOWN/UP/SINGLE/DOUBLE），调用后标志会自动清除。
  */
-uint8_t Key_Check(uint8_t Flag){
-	if(Key_Flag & Flag){
+uint8_t Key_Check(uint8_t n, uint8_t Flag){
+	if(n < KEY_TOTAL && (Key_States[n].Flag & Flag)){
 		if(Flag != KEY_HOLD){
-			Key_Flag &= ~Flag;
+			Key_States[n].Flag &= ~Flag;
 		}
 		return 1;
 	}
@@ -117,91 +336,273 @@ uint8_t Key_Check(uint8_t Flag){
 }
 
 /**
- * @brief  按键状态扫描与事件判定
+ * @brief  获取最近一次单击 / 双击 / 多击事件的按下次数
+ * @param  n 按键编号
+ * @retval 按下次数（1、2、3 ...），与 KEY_MULTI 配合使用
+ */
+uint8_t Key_GetClicks(uint8_t n){
+	if(n < KEY_TOTAL){
+		return Key_States[n].LastClicks;
+	}
+	return 0;
+}
+
+/**
+ * @brief  修改按键的时间参数
+ * @param  n      按键编号
+ * @param  Timing 新的时间参数
+ * @note   从下一次计时开始生效；MaxClicks 为 0 时按 1 处理。
+ *         定时器中断会读取这些参数，复制期间关中断，避免中断读到新旧混合的参数。
+ */
+void Key_SetTiming(uint8_t n, const Key_Timing_t *Timing){
+	if(n < KEY_TOTAL){
+		__disable_irq();
+		Key_States[n].Timing = *Timing;
+		__enable_irq();
+	}
+}
+
+/**
+ * @brief  读取按键的时间参数
+ * @param  n      按键编号
+ * @param  Timing 接收时间参数的结构体
+ */
+void Key_GetTiming(uint8_t n, Key_Timing_t *Timing){
+	if(n < KEY_TOTAL){
+		__disable_irq();
+		*Timing = Key_States[n].Timing;
+		__enable_irq();
+	}
+}
+
+/**
+ * @brief  判断按键的计时是否已到
+ */
+static uint8_t Key_Expired(const Key_State_t *Key){
+	return (int32_t)(Key_Time - Key->Deadline) >= 0;
+}
+
+/**
+ * @brief  上报按键事件：置位标志并写入事件队列
+ */
+static void Key_Report(uint8_t n, uint8_t Flag, uint8_t Count){
+	Key_States[n].Flag |= Flag;
+	KeyEvent_Push(n, Flag, Count, Key_Time);
+}
+
+/**
+ * @brief  上报本轮的按下次数：1 次为单击，2 次为双击，更多为 KEY_MULTI
+ */
+static void Key_ReportClicks(uint8_t n){
+	Key_State_t *Key = &Key_States[n];
+	
+	Key->LastClicks = Key->Clicks;
+	if(Key->Clicks == 1){
+		Key_Report(n, KEY_SINGLE, 1);
+	}else if(Key->Clicks == 2){
+		Key_Report(n, KEY_DOUBLE, 2);
+	}else{
+		Key_Report(n, KEY_MULTI, Key->Clicks);
+	}
+}
+
+/**
+ * @brief  单个按键的状态机
+ * @param  n    按键编号
+ * @param  Curr 本次扫描的状态（KEY_PRESSED / KEY_UNPRESSED）
+ * @param  Prev 上次扫描的状态
+ * @retval 1：按键仍在计时，下次扫描需要继续处理
+ * @retval 0：按键进入只等待电平变化的状态
  * @note
- * - 建议每 20ms 调用一次；
- * - 内部实现多态状态机，判断单击、双击、长按、连击；
- * - 各事件通过 `Key_Flag` 设置标志位，由 `Key_Check()` 读取。
+ * - 0 空闲 -> 1 按下：计时长按；
+ * - 1 松开：按下次数达到 MaxClicks 则立即上报，否则进入 2 等待下一次按下；
+ * - 2 再次按下：达到 MaxClicks 则上报并进入 3 等待松开，否则进入 5 等待松开后回到 2；
+ *   超时未按下则上报已有的次数；
+ * - 1 长按到时：上报 LONG，进入 4 连击，间隔从 RepeatTime 每次缩短 RepeatStep 直到 RepeatMin。
  */
-void Key_Tick(void){
-	static uint8_t Count = 0;
-	static uint8_t CurrentState, PrevState;
-	static uint8_t State = 0;
-	static int16_t Time = 0;
+static uint8_t Key_Process(uint8_t n, uint8_t Curr, uint8_t Prev){
+	Key_State_t *Key = &Key_States[n];
+	const Key_Timing_t *Timing = &Key->Timing;
 	
-	if(Time > 0){
-		Time--;
+	// HOLD 检测
+	if(Curr == KEY_PRESSED){
+		Key->Flag |= KEY_HOLD;
+	}else{
+		Key->Flag &= ~KEY_HOLD;
 	}
 	
-	if(Count >= 20){
-		Count = 0;
-		
-		PrevState = CurrentState;
-		CurrentState = Key_GetState();
-		
-		// HOLD 检测
-		if(CurrentState == KEY_PRESSED){
-			Key_Flag |= KEY_HOLD;
-		}else{
-			Key_Flag &= ~KEY_HOLD;
-		}
-		
-		// 边沿检测：按下/松开
-		if(CurrentState == KEY_PRESSED && PrevState == KEY_UNPRESSED){
-			Key_Flag |= KEY_DOWN;
-		}
-		if(CurrentState == KEY_UNPRESSED && PrevState == KEY_PRESSED){
-			Key_Flag |= KEY_UP;
-		}
-		
-		// 状态机逻辑
-		switch(State){
-			case 0:
-				if(CurrentState == KEY_PRESSED){
-					State = 1;
-					Time = KEY_TIME_LONG;
+	// 边沿检测：按下/松开
+	if(Curr == KEY_PRESSED && Prev == KEY_UNPRESSED){
+		Key_Report(n, KEY_DOWN, 0);
+	}
+	if(Curr == KEY_UNPRESSED && Prev == KEY_PRESSED){
+		Key_Report(n, KEY_UP, 0);
+	}
+	
+	// 状态机逻辑
+	switch(Key->State){
+		case 0:
+			if(Curr == KEY_PRESSED){
+				Key->Clicks = 0;
+				Key->Deadline = Key_Time + Timing->LongTime;
+				Key->State = 1;
+			}
+			break;
+			
+		case 1:
+			if(Curr == KEY_UNPRESSED){
+				Key->Clicks = 1;
+				if(Key->Clicks >= Timing->MaxClicks){
+					Key_ReportClicks(n); // 不识别多击，松开即单击
+					Key->State = 0;
+				}else{
+					Key->Deadline = Key_Time + Timing->ClickTime; // 等待下一次按下
+					Key->State = 2;
 				}
-				break;
-				
-			case 1:
-				if(CurrentState == KEY_UNPRESSED){
-					Time = KEY_TIME_DOUBLE; // 等待双击
-					State = 2; 
-				}else if(Time == 0){
-					Key_Flag |= KEY_LONG; // 长按事件
-					Time = KEY_TIME_REPEAT;
-					State = 4; // 进入连击状态
+			}else if(Key_Expired(Key)){
+				Key_Report(n, KEY_LONG, 0); // 长按事件
+				Key->Repeats = 0;
+				Key->Interval = Timing->RepeatTime;
+				Key->Deadline = Key_Time + Key->Interval;
+				Key->State = 4; // 进入连击状态
+			}
+			break;
+			
+		case 2:
+			if(Curr == KEY_PRESSED){
+				Key->Clicks++;
+				if(Key->Clicks >= Timing->MaxClicks){
+					Key_ReportClicks(n); // 达到上限，立即上报
+					Key->State = 3;
+				}else{
+					Key->State = 5;
 				}
-				break;
-				
-			case 2:
-				if(CurrentState == KEY_PRESSED){
-					Key_Flag |= KEY_DOUBLE; // 双击
-					State = 3;
-				}else if(Time == 0){
-					Key_Flag |= KEY_SINGLE; // 单击
-					State = 0;
+			}else if(Key_Expired(Key)){
+				Key_ReportClicks(n); // 超时，上报已有的次数
+				Key->State = 0;
+			}
+			break;
+			
+		case 3:
+			if(Curr == KEY_UNPRESSED){
+				Key->State = 0;
+			}
+			break;
+		
+		case 4:
+			if(Curr == KEY_UNPRESSED){
+				Key->State = 0;
+			}else if(Key_Expired(Key)){
+				if(Key->Repeats < 255){
+					Key->Repeats++;
 				}
-				break;
+				Key_Report(n, KEY_REPEAT, Key->Repeats); // 长按重复
 				
-			case 3:
-				if(CurrentState == KEY_UNPRESSED){
-					State = 0;
+				// 连击加速
+				if(Key->Interval >= Timing->RepeatMin + Timing->RepeatStep){
+					Key->Interval -= Timing->RepeatStep;
+				}else{
+					Key->Interval = Timing->RepeatMin;
 				}
-				break;
+				Key->Deadline = Key_Time + Key->Interval;
+			}
+			break;
 			
-			case 4:
-				if(CurrentState == KEY_UNPRESSED){
-					State = 0;
-				}else if(Time == 0){
-					Key_Flag |= KEY_REPEAT; // 长按重复
-					Time = KEY_TIME_REPEAT;
-					State = 4;
-				}
-				break;
+		case 5:
+			if(Curr == KEY_UNPRESSED){
+				Key->Deadline = Key_Time + Timing->ClickTime;
+				Key->State = 2;
+			}
+			break;
+	}
+	
+	// 状态 0、3、5 只等待电平变化，无需每次扫描
+	return Key->State == 1 || Key->State == 2 || Key->State == 4;
+}
+
+/**
+ * @brief  把一组按键的消抖结果分发给状态机
+ * @param  Map     位号 -> 按键编号的映射表，为 0 时按键编号为 Base + 位号
+ * @param  Base    Map 为 0 时的起始按键编号
+ * @param  Now     稳定状态（1 = 按下）
+ * @param  Changed 本次稳定状态发生变化的位
+ * @param  Busy    正在计时的位，返回时已更新
+ * @note   只有 Changed 或 Busy 中的位才会进入状态机。
+ */
+static void Key_Dispatch(const uint8_t *Map, uint8_t Base, uint16_t Now, uint16_t Changed, uint16_t *Busy){
+	uint16_t Work = Changed | *Busy;
+	uint16_t Bit;
+	uint8_t Pin;
+	
+	while(Work){
+		Pin = 31 - __CLZ(Work);
+		Bit = 1 << Pin;
+		Work &= ~Bit;
+		if(Key_Process(Map ? Map[Pin] : Base + Pin, (Now & Bit) ? KEY_PRESSED : KEY_UNPRESSED,
+		               ((Now ^ Changed) & Bit) ? KEY_PRESSED : KEY_UNPRESSED)){
+			*Busy |= Bit;
+		}else{
+			*Busy &= ~Bit;
 		}
 	}
-	Count++;
+}
+
+/**
+ * @brief  按键状态扫描与事件判定
+ * @note
+ * - 每 1ms 调用一次（TIM1 更新中断），内部每 KEY_TIME_SAMPLE 毫秒采样一次；
+ * - 每个端口只读一次 IDR 并整体消抖，稳定状态变化或正在计时的按键才进入状态机；
+ * - 定义 KEY_MATRIX 时同时扫描矩阵键盘，每行按同样方式分发；
+ * - 各事件写入按键各自的标志位（由 `Key_Check()` 读取），同时写入事件队列。
+ */
+void Key_Tick(void){
+	static uint8_t Count = 0;
+	uint8_t p;
+	uint16_t Sample, Changed;
+#ifdef KEY_WAKE_EXTI
+	uint8_t Idle = 1;
+#endif
+	Key_Port_t *Port;
+	
+	Key_Time++;
+	
+#ifdef KEY_ENCODER
+	Encoder_Tick();
+#endif
+	
+	if(++Count < KEY_TIME_SAMPLE){
+		return;
+	}
+	Count = 0;
+	
+	for(p = 0; p < Key_PortCount; p++){
+		Port = &Key_Ports[p];
+		Sample = ((uint16_t)Port->Port->IDR ^ Port->Invert) & Port->Mask;
+		Changed = Debounce_Update(&Port->Debounce, Sample);
+		Key_Dispatch(Port->Key, 0, Port->Debounce.State, Changed, &Port->Busy);
+		
+#ifdef KEY_WAKE_EXTI
+		// 没有按下、没有正在消抖的引脚、也没有按键在计时
+		if(Sample | Port->Debounce.State | Port->Busy){
+			Idle = 0;
+		}
+#endif
+	}
+	
+#ifdef KEY_MATRIX
+	const Debounce_t *Row;
+	KeyMatrix_Scan();
+	for(p = 0; p < KEYMATRIX_ROWS; p++){
+		Row = KeyMatrix_GetRow(p);
+		Key_Dispatch(0, KEY_MATRIX_ID(p, 0), Row->State, Row->Pressed | Row->Released, &Key_MatrixBusy[p]);
+	}
+#endif
+	
+#ifdef KEY_WAKE_EXTI
+	if(Idle){
+		Key_Sleep();
+	}
+#endif
 }
 
 // void TIM1_IRQHandler(void){
@@ -10,7 +10,13 @@
  * @attention
  * - 本头文件需与 Key_Full.c 搭配使用；
  * - 调用前请确保 GPIO 和定时器时钟已正确初始化；
- * - 推荐在 SysTick 或定时器中周期性调用 Key_Tick() 函数实现去抖与状态检测。
+ * - 推荐在 SysTick 或定时器中周期性调用 Key_Tick() 函数实现去抖与状态检测；
+ * - 定义 KEY_WAKE_EXTI 后按键空闲时 TIM1 停止，由按键引脚的 EXTI 下降沿唤醒
+ *   （通过 EXTI_Register() 注册，无需自己编写 EXTIx_IRQHandler）。此时 TIM1 只能供按键使用，
+ *   按键必须为低电平有效，且各按键的引脚号互不相同（同号引脚共用一条 EXTI 线）；
+ * - 定义 KEY_MATRIX 后矩阵键盘（KeyMatrix.h）的按键与直连按键一样产生全部事件；
+ * - 定义 KEY_ENCODER 后初始化旋转编码器（Encoder.h），其按键作为 KEY_ENC 产生全部事件，
+ *   Key_Tick() 同时负责编码器的速度采样。
  ******************************************************************************
  */
 
@@ -23,6 +29,23 @@
 extern "C" {
 #endif
 
+/* 配置 ---------------------------------------------------------------------*/
+//#define KEY_WAKE_EXTI     ///< 空闲时停止 TIM1 扫描，由 EXTI 唤醒
+//#define KEY_MATRIX        ///< 同时扫描 KeyMatrix 矩阵键盘
+//#define KEY_ENCODER       ///< 使用 Encoder 旋转编码器，其按键作为 KEY_ENC
+
+#if defined(KEY_WAKE_EXTI) && (defined(KEY_MATRIX) || defined(KEY_ENCODER))
+#error "KEY_WAKE_EXTI does not support KEY_MATRIX or KEY_ENCODER"
+#endif
+
+#ifdef KEY_MATRIX
+#include "KeyMatrix.h"
+#endif
+
+#ifdef KEY_ENCODER
+#include "Encoder.h"
+#endif
+
 /* 按键状态标志定义 ---------------------------------------------------------*/
 #define KEY_HOLD     0x01  ///< 按键持续按下状态
 #define KEY_DOWN     0x02  ///< 按键按下瞬间
@@ -31,13 +54,63 @@ extern "C" {
 #define KEY_DOUBLE   0x10  ///< 双击
 #define KEY_LONG     0x20  ///< 长按
 #define KEY_REPEAT   0x40  ///< 连续按压（重复触发）
+#define KEY_MULTI    0x80  ///< 三击及以上（次数由 Key_GetClicks() 或事件的 Count 给出）
+
+/* 按键编号，与 Key_Full.c 中 Key_Table 的顺序一致 -------------------------*/
+#define KEY_1        0     ///< PA2
+#define KEY_2        1     ///< PA3
+#ifdef KEY_ENCODER
+#define KEY_ENC      2     ///< PA5，编码器按键
+#define KEY_COUNT    3     ///< 直连按键数
+#else
+#define KEY_COUNT    2     ///< 直连按键数
+#endif
+
+/* 矩阵按键编号接在直连按键之后：第 Row 行第 Col 列为 KEY_MATRIX_ID(Row, Col) */
+#ifdef KEY_MATRIX
+#define KEY_MATRIX_ID(Row, Col) (KEY_COUNT + (Row) * KEYMATRIX_COLS + (Col))
+#define KEY_TOTAL    (KEY_COUNT + KEYMATRIX_ROWS * KEYMATRIX_COLS)  ///< 按键总数
+#else
+#define KEY_TOTAL    KEY_COUNT                                      ///< 按键总数
+#endif
+
+/**
+ * @brief 按键时间参数（单位：ms），每个按键一份，可在运行时修改
+ */
+typedef struct {
+	uint16_t LongTime;      ///< 长按判定时间
+	uint16_t ClickTime;     ///< 多击间隔：松开后等待下一次按下的时间
+	uint16_t RepeatTime;    ///< 长按后第一次连击的间隔
+	uint16_t RepeatMin;     ///< 连击的最小间隔
+	uint16_t RepeatStep;    ///< 每次连击后间隔缩短的量，0 表示不加速
+	uint8_t MaxClicks;      ///< 连按次数上限：1 松开即单击，2 第二次按下即双击，N 第 N 次按下即上报
+} Key_Timing_t;
+
+/**
+ * @brief 按键描述（只读配置）
+ */
+typedef struct {
+	GPIO_TypeDef *Port;             ///< GPIO 端口
+	uint16_t Pin;                   ///< 引脚掩码（GPIO_Pin_x，单个引脚）
+	uint8_t ActiveLevel;            ///< 按下时的电平：0 低电平有效，1 高电平有效
+	const Key_Timing_t *Timing;     ///< 初始时间参数，为 0 时使用默认值
+} Key_Desc_t;
 
 /* 函数声明 -----------------------------------------------------------------*/
 void Key_Init(void);
-uint8_t Key_GetState(void);
-uint8_t Key_Check(uint8_t Flag);
+uint8_t Key_GetState(uint8_t n);
+uint8_t Key_Check(uint8_t n, uint8_t Flag);
+uint8_t Key_GetClicks(uint8_t n);
+void Key_SetTiming(uint8_t n, const Key_Timing_t *Timing);
+void Key_GetTiming(uint8_t n, Key_Timing_t *Timing);
 void Key_Tick(void);
 
+/*低功耗扫描函数，定义KEY_WAKE_EXTI时可用*/
+#ifdef KEY_WAKE_EXTI
+void Key_Wake(void);
+uint8_t Key_IsScanning(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
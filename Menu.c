@@ -0,0 +1,316 @@
+/**
+ ******************************************************************************
+ * @file    Menu.c
+ * @brief   基于 Key_Full 按键事件的多级菜单模块（按行惰性刷新）
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 本文件实现一个由 const 菜单表驱动的多级菜单，按键操作（单按键）：
+ *
+ *   浏览状态：单击 -> 下一项      双击 -> 返回上一级      长按 -> 进入 / 编辑 / 执行
+ *   编辑状态：单击 -> 数值 +Step  双击 -> 确认并退出编辑  长按并保持 -> 连续增加（逐渐加速）
+ *
+ * 数值超过 Max 后回绕到 Min，因此单按键也能调到任意值。
+ *
+ * 刷新策略：
+ * - 每一行（标题行 + 菜单项行）对应 Menu_DirtyRows 中的一个标志位；
+ * - 选中项变化只标记新旧两行，数值变化只标记该行，翻页 / 换页才标记全部行；
+ * - Menu_Process() 在没有脏行时立即返回，空闲时几乎不占 CPU，
+ *   也不访问 I2C 总线；
+ * - 每个脏行单独清除、绘制并通过 OLED_UpdateArea() 只发送这一行。
+ *
+ * 按键事件队列（KeyEvent）只有一个消费者，由应用程序负责取出，
+ * 再交给 Menu_HandleKey()；不属于菜单的事件原样留给应用程序处理。
+ *
+ * 依赖：
+ * - Key_Full.h
+ * - KeyEvent.h
+ * - OLED.h
+ * - Menu.h
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "Key_Full.h"
+#include "KeyEvent.h"
+#include "OLED.h"
+#include "Menu.h"
+
+/* 布局参数 */
+#define MENU_ROW_HEIGHT     (MENU_FONT == OLED_8X16 ? 16 : 8)   /**< 行高 */
+#define MENU_ROWS           (OLED_HEIGHT / MENU_ROW_HEIGHT - 1)          /**< 菜单项可见行数（不含标题行） */
+#define MENU_DIRTY_ALL      0xFF                                /**< 全部行需要重绘 */
+
+/* 菜单导航状态 */
+static const Menu_Page_t *Menu_Stack[MENU_DEPTH_MAX];   /**< 上级菜单页 */
+static uint8_t Menu_StackSel[MENU_DEPTH_MAX];           /**< 上级菜单页的选中项 */
+static uint8_t Menu_Depth;                              /**< 当前层级 */
+static const Menu_Page_t *Menu_Page;                    /**< 当前菜单页 */
+static uint8_t Menu_Selected;                           /**< 当前选中项 */
+static uint8_t Menu_Top;                                /**< 第一可见行对应的菜单项 */
+
+/* 编辑与按键状态 */
+static uint8_t Menu_Editing;                            /**< 是否处于编辑状态 */
+static uint8_t Menu_WaitRelease;                        /**< 长按触发进入后，松开前忽略连击 */
+static uint8_t Menu_RepeatCount;                        /**< 当前长按的连击次数，用于加速 */
+
+/* 脏行标志：Bit0 为标题行，Bit(n) 为第 n 个菜单项行 */
+static uint8_t Menu_DirtyRows;
+
+/* 连击加速倍率：每 10 次连击（约 1 秒）升一级 */
+static const uint8_t Menu_Accel[] = {1, 2, 5, 10};
+
+/**
+ * @brief  标记菜单项 Index 所在的行为脏行（不可见时忽略）
+ */
+static void Menu_MarkItem(uint8_t Index){
+	if(Index >= Menu_Top && Index < Menu_Top + MENU_ROWS){
+		Menu_DirtyRows |= 0x02 << (Index - Menu_Top);
+	}
+}
+
+/**
+ * @brief  切换到指定菜单页
+ */
+static void Menu_Show(const Menu_Page_t *Page, uint8_t Selected){
+	Menu_Page = Page;
+	Menu_Selected = Selected;
+	Menu_Top = Selected >= MENU_ROWS ? Selected - MENU_ROWS + 1 : 0;
+	Menu_Editing = 0;
+	Menu_DirtyRows = MENU_DIRTY_ALL;
+}
+
+/**
+ * @brief  移动选中项，必要时滚动
+ */
+static void Menu_Select(uint8_t Index){
+	if(Index == Menu_Selected){
+		return;
+	}
+
+	if(Index < Menu_Top){
+		Menu_Top = Index;
+		Menu_DirtyRows = MENU_DIRTY_ALL;
+	}else if(Index >= Menu_Top + MENU_ROWS){
+		Menu_Top = Index - MENU_ROWS + 1;
+		Menu_DirtyRows = MENU_DIRTY_ALL;
+	}else{
+		Menu_MarkItem(Menu_Selected);
+		Menu_MarkItem(Index);
+	}
+	Menu_Selected = Index;
+}
+
+/**
+ * @brief  返回上一级菜单
+ */
+static void Menu_Back(void){
+	if(Menu_Depth > 0){
+		Menu_Depth--;
+		Menu_Show(Menu_Stack[Menu_Depth], Menu_StackSel[Menu_Depth]);
+	}
+}
+
+/**
+ * @brief  对当前选中项执行“进入”操作
+ */
+static void Menu_Enter(void){
+	const Menu_Item_t *Item = &Menu_Page->Items[Menu_Selected];
+
+	switch(Item->Type){
+		case MENU_SUBMENU:
+			if(Item->Child && Menu_Depth < MENU_DEPTH_MAX){
+				Menu_Stack[Menu_Depth] = Menu_Page;
+				Menu_StackSel[Menu_Depth] = Menu_Selected;
+				Menu_Depth++;
+				Menu_Show(Item->Child, 0);
+			}
+			break;
+
+		case MENU_VALUE:
+			if(Item->Value){
+				Menu_Editing = 1;
+				Menu_MarkItem(Menu_Selected);
+			}
+			break;
+
+		case MENU_ACTION:
+			if(Item->Action){
+				Item->Action();
+			}
+			break;
+
+		case MENU_BACK:
+			Menu_Back();
+			break;
+	}
+}
+
+/**
+ * @brief  编辑状态下调整数值，超出范围时回绕
+ */
+static void Menu_Adjust(int16_t Delta){
+	const Menu_Item_t *Item = &Menu_Page->Items[Menu_Selected];
+	int32_t Value = *Item->Value + Delta;
+
+	if(Value > Item->Max){
+		Value = Item->Min;
+	}else if(Value < Item->Min){
+		Value = Item->Max;
+	}
+	if(Value != *Item->Value){
+		*Item->Value = Value;
+		Menu_MarkItem(Menu_Selected);
+	}
+}
+
+/**
+ * @brief  绘制并发送一行
+ * @param  Row 0 为标题行，1~MENU_ROWS 为菜单项行
+ */
+static void Menu_DrawRow(uint8_t Row){
+	int16_t Y = Row * MENU_ROW_HEIGHT;
+	uint8_t Index;
+	const Menu_Item_t *Item;
+	char Buf[12];
+
+	OLED_ClearArea(0, Y, OLED_WIDTH, MENU_ROW_HEIGHT);
+
+	if(Row == 0){
+		OLED_ShowString(0, Y, (char *)Menu_Page->Title, MENU_FONT);
+		OLED_DrawLine(0, Y + MENU_ROW_HEIGHT - 1, OLED_WIDTH - 1, Y + MENU_ROW_HEIGHT - 1);
+	}else{
+		Index = Menu_Top + Row - 1;
+		if(Index < Menu_Page->Count){
+			Item = &Menu_Page->Items[Index];
+			OLED_ShowString(MENU_FONT, Y, (char *)Item->Name, MENU_FONT);
+
+			// 右侧附加信息：数值或子菜单标记
+			Buf[0] = '\0';
+			if(Item->Type == MENU_VALUE && Item->Value){
+				sprintf(Buf, (Menu_Editing && Index == Menu_Selected) ? "<%d>" : "%d", *Item->Value);
+			}else if(Item->Type == MENU_SUBMENU){
+				strcpy(Buf, ">");
+			}
+			OLED_ShowString(OLED_WIDTH - strlen(Buf) * MENU_FONT, Y, Buf, MENU_FONT);
+
+			if(Index == Menu_Selected){
+				OLED_ReverseArea(0, Y, OLED_WIDTH, MENU_ROW_HEIGHT);
+			}
+		}
+	}
+
+	OLED_UpdateArea(0, Y, OLED_WIDTH, MENU_ROW_HEIGHT);
+}
+
+/**
+ * @brief  初始化菜单并显示根菜单
+ * @param  Root 根菜单页
+ */
+void Menu_Init(const Menu_Page_t *Root){
+	Menu_Depth = 0;
+	Menu_WaitRelease = 0;
+	Menu_RepeatCount = 0;
+	Menu_Show(Root, 0);
+}
+
+/**
+ * @brief  处理一个菜单按键事件
+ * @param  Event 事件类型（KEY_UP、KEY_SINGLE 等）
+ */
+static void Menu_HandleEvent(uint8_t Event){
+	uint8_t Row;
+
+	if(Event == KEY_UP){
+		Menu_WaitRelease = 0;
+		Menu_RepeatCount = 0;
+		return;
+	}
+
+	if(Menu_Editing){
+		if(Event == KEY_SINGLE){
+			Menu_Adjust(Menu_Page->Items[Menu_Selected].Step);
+		}else if(Event == KEY_LONG && !Menu_WaitRelease){
+			Menu_RepeatCount = 0;
+			Menu_Adjust(Menu_Page->Items[Menu_Selected].Step);
+		}else if(Event == KEY_REPEAT && !Menu_WaitRelease){
+			if(Menu_RepeatCount < 255){
+				Menu_RepeatCount++;
+			}
+			Row = Menu_RepeatCount / 10;
+			if(Row >= sizeof(Menu_Accel)){
+				Row = sizeof(Menu_Accel) - 1;
+			}
+			Menu_Adjust(Menu_Page->Items[Menu_Selected].Step * Menu_Accel[Row]);
+		}else if(Event == KEY_DOUBLE){
+			Menu_Editing = 0;
+			Menu_MarkItem(Menu_Selected);
+			if(Menu_Page->Items[Menu_Selected].Action){
+				Menu_Page->Items[Menu_Selected].Action();
+			}
+		}
+	}else{
+		if(Event == KEY_SINGLE && Menu_Page->Count){
+			Menu_Select(Menu_Selected + 1 < Menu_Page->Count ? Menu_Selected + 1 : 0);
+		}else if(Event == KEY_DOUBLE){
+			Menu_Back();
+		}else if(Event == KEY_LONG && Menu_Page->Count){
+			Menu_WaitRelease = 1;       // 本次长按已被消耗，松开前的连击不再生效
+			Menu_Enter();
+		}
+		// 浏览状态不使用连击，丢弃
+	}
+}
+
+/**
+ * @brief  把一个按键事件交给菜单
+ * @param  Event 从 KeyEvent_Pop() 取出的事件
+ * @retval 1：事件属于 MENU_KEY 且已被菜单处理；0：不是菜单的事件，由调用者自行处理
+ * @note   典型用法：
+ *         while(KeyEvent_Pop(&Event)){
+ *             if(!Menu_HandleKey(&Event)){ ... 其他按键 ... }
+ *         }
+ *         Menu_Process();
+ */
+uint8_t Menu_HandleKey(const KeyEvent_t *Event){
+	if(Menu_Page == 0 || Event->Key != MENU_KEY){
+		return 0;
+	}
+	Menu_HandleEvent(Event->Event);
+	return 1;
+}
+
+/**
+ * @brief  菜单处理：重绘脏行
+ * @note   在主循环中反复调用；没有脏行时立即返回。
+ */
+void Menu_Process(void){
+	uint8_t Row;
+
+	if(Menu_Page == 0 || Menu_DirtyRows == 0){
+		return;
+	}
+	for(Row = 0; Row <= MENU_ROWS; Row++){
+		if(Menu_DirtyRows & (1 << Row)){
+			Menu_DrawRow(Row);
+		}
+	}
+	Menu_DirtyRows = 0;
+}
+
+/**
+ * @brief  强制重绘整个菜单（例如菜单外部修改了被编辑的变量）
+ */
+void Menu_Refresh(void){
+	Menu_DirtyRows = MENU_DIRTY_ALL;
+}
+
+/**
+ * @brief  查询是否处于数值编辑状态
+ */
+uint8_t Menu_IsEditing(void){
+	return Menu_Editing;
+}
@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @file    Menu.h
+ * @brief   基于 Key_Full 按键事件的多级菜单模块头文件
+ * @note    声明菜单项 / 菜单页结构与菜单处理函数接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 菜单页与菜单项均可定义为 const 表，存放在 Flash 中；
+ * - 可编辑数值本身位于 RAM，菜单项中只保存其指针；
+ * - 需先调用 Key_Init() 与 OLED_Init()，并在 TIM1 中断中调用 Key_Tick()；
+ * - 菜单不直接读取 KeyEvent 队列，应用程序取出事件后调用 Menu_HandleKey()。
+ ******************************************************************************
+ */
+
+#ifndef __MENU_H
+#define __MENU_H
+
+#include <stdint.h>
+#include "KeyEvent.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+#ifndef MENU_FONT
+#define MENU_FONT           OLED_6X8    ///< 菜单字体：OLED_6X8（7 行）/ OLED_8X16（3 行）
+#endif
+
+#ifndef MENU_DEPTH_MAX
+#define MENU_DEPTH_MAX      4           ///< 最大菜单层级
+#endif
+
+#ifndef MENU_KEY
+#define MENU_KEY            KEY_1       ///< 操作菜单的按键编号（见 Key_Full.h）
+#endif
+
+/* 菜单项类型 ---------------------------------------------------------------*/
+#define MENU_SUBMENU        0   ///< 进入子菜单
+#define MENU_VALUE          1   ///< 编辑数值
+#define MENU_ACTION         2   ///< 执行回调
+#define MENU_BACK           3   ///< 返回上一级
+
+/* 菜单结构 -----------------------------------------------------------------*/
+typedef struct Menu_Page Menu_Page_t;
+
+typedef struct
+{
+	const char *Name;           ///< 显示名称
+	uint8_t Type;               ///< 菜单项类型（MENU_SUBMENU 等）
+	const Menu_Page_t *Child;   ///< MENU_SUBMENU：子菜单页
+	int16_t *Value;             ///< MENU_VALUE：被编辑的变量
+	int16_t Min, Max, Step;     ///< MENU_VALUE：取值范围与步进
+	void (*Action)(void);       ///< MENU_ACTION：回调函数；MENU_VALUE：数值确认后的回调，可为 NULL
+} Menu_Item_t;
+
+struct Menu_Page
+{
+	const char *Title;          ///< 标题（显示在第一行）
+	const Menu_Item_t *Items;   ///< 菜单项表
+	uint8_t Count;              ///< 菜单项数量
+};
+
+/* 函数声明 -----------------------------------------------------------------*/
+void Menu_Init(const Menu_Page_t *Root);
+uint8_t Menu_HandleKey(const KeyEvent_t *Event);
+void Menu_Process(void);
+void Menu_Refresh(void);
+uint8_t Menu_IsEditing(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MENU_H */
@@ -0,0 +1,40 @@
+/**
+ ******************************************************************************
+ * @file    MyDWT.c
+ * @brief   Cortex-M3 DWT 周期计数器
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 用于代码耗时测量与高精度时间戳，不占用任何定时器。
+ * 调试器连接时 DWT 通常已被使能，脱机运行时必须先调用 MyDWT_Init()。
+ ******************************************************************************
+ */
+
+#include "stm32f10x.h"                  // Device header
+#include "MyDWT.h"
+
+/**
+ * @brief  使能 DWT 并启动周期计数器
+ * @note   可被多个模块重复调用：计数器已在运行时不清零，
+ *         以免打断其他模块正在进行的测量（各模块都只使用两次读数之差）。
+ */
+void MyDWT_Init(void)
+{
+	MYDWT_DEMCR |= 1UL << 24;       // TRCENA：使能 DWT / ITM
+	if(!(MYDWT_CTRL & (1UL << 0))){
+		MYDWT_CYCCNT = 0;
+		MYDWT_CTRL |= 1UL << 0;     // CYCCNTENA：启动周期计数
+	}
+}
+
+/**
+ * @brief  周期数换算为微秒
+ * @param  Cycles 周期数
+ * @retval 微秒数（向下取整）
+ */
+uint32_t MyDWT_CyclesToUs(uint32_t Cycles)
+{
+	return Cycles / (SystemCoreClock / 1000000);
+}
@@ -0,0 +1,40 @@
+/**
+ ******************************************************************************
+ * @file    MyDWT.h
+ * @brief   Cortex-M3 DWT 周期计数器头文件
+ * @note    提供 CYCCNT 寄存器访问宏与初始化、换算函数声明。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 标准外设库自带的 core_cm3.h 没有 DWT 结构体，这里直接使用寄存器地址；
+ * - CYCCNT 以内核时钟（72MHz 时约 13.9ns）递增，约 59.6 秒回绕一次，
+ *   两次读数相减（无符号）即可得到间隔周期数，回绕不影响结果。
+ ******************************************************************************
+ */
+
+#ifndef __MYDWT_H
+#define __MYDWT_H
+
+#include "stm32f10x.h"  ///< STM32 标准外设库头文件
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MYDWT_DEMCR         (*(volatile uint32_t *)0xE000EDFC)  ///< 调试异常与监视控制寄存器
+#define MYDWT_CTRL          (*(volatile uint32_t *)0xE0001000)  ///< DWT 控制寄存器
+#define MYDWT_CYCCNT        (*(volatile uint32_t *)0xE0001004)  ///< DWT 周期计数器
+
+/** 读取当前周期数（单条读指令，可在中断中使用） */
+#define MyDWT_GetCycles()   (MYDWT_CYCCNT)
+
+void MyDWT_Init(void);
+uint32_t MyDWT_CyclesToUs(uint32_t Cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MYDWT_H */
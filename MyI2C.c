@@ -0,0 +1,485 @@
+/**
+ ******************************************************************************
+ * @file    MyI2C.c
+ * @brief   通用 I2C 主机总线驱动（软件 / 硬件两种实现 + 事务队列）
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 本文件实现 OLED 与传感器共用的 I2C 主机：
+ * - 支持读、写、重复起始，检查每个字节的 ACK / NACK；
+ * - 软件实现释放 SCL 后等待其真正变高，支持从机时钟延展；
+ *   SCL 高、低电平各延时一次，延时循环次数由 DWT 按 SystemCoreClock 与 MYI2C_CLOCK_HZ 校准；
+ * - 硬件实现使用 I2C1（重映射到 PB8 / PB9），出错时复位外设；
+ * - 事务以 MyI2C_Xfer_t 描述，提交到队列后由 MyI2C_Process() 逐个执行，
+ *   OLED 刷新与传感器读取按事务粒度交替进行，互不长时间阻塞。
+ *
+ * 依赖：
+ * - stm32f10x.h
+ * - MyDWT.h（软件实现校准延时）
+ * - MyI2C.h
+ ******************************************************************************
+ */
+
+#include "stm32f10x.h"                  // Device header
+#include "MyDWT.h"
+#include "MyI2C.h"
+
+/* 事务队列：只保存调用者提供的描述结构指针 */
+static MyI2C_Xfer_t *MyI2C_Queue[MYI2C_QUEUE_SIZE];
+static volatile uint8_t MyI2C_Head;     /**< 下一个待执行事务 */
+static volatile uint8_t MyI2C_Tail;     /**< 下一个空位 */
+
+#ifndef MYI2C_HARDWARE
+
+/* ============================== 软件 I2C ============================== */
+
+#define MYI2C_PORT          GPIOB
+#define MYI2C_SCL           GPIO_Pin_8
+#define MYI2C_SDA           GPIO_Pin_9
+
+#define MyI2C_SCL_L()       (MYI2C_PORT->BRR = MYI2C_SCL)
+#define MyI2C_SDA_H()       (MYI2C_PORT->BSRR = MYI2C_SDA)
+#define MyI2C_SDA_L()       (MYI2C_PORT->BRR = MYI2C_SDA)
+#define MyI2C_SCL_Read()    (MYI2C_PORT->IDR & MYI2C_SCL)
+#define MyI2C_SDA_Read()    (MYI2C_PORT->IDR & MYI2C_SDA)
+
+#ifdef MYI2C_DELAY_LOOPS
+static uint32_t MyI2C_DelayLoops = MYI2C_DELAY_LOOPS;
+#else
+static uint32_t MyI2C_DelayLoops;   /**< 半周期延时循环次数，由 MyI2C_Calibrate() 计算 */
+#endif
+
+/**
+ * @brief  半个 SCL 周期延时
+ */
+static void MyI2C_Delay(void){
+	volatile uint32_t n = MyI2C_DelayLoops;
+	while(n--);
+}
+
+#ifndef MYI2C_DELAY_LOOPS
+/**
+ * @brief  校准延时循环次数
+ * @note   用 DWT 测出空循环的固定开销与每次循环的周期数，
+ *         快速模式要求 SCL 低电平不短于 1.3us（周期的 52%），
+ *         因此高、低电平都按 52% 周期计算，实际频率略低于 MYI2C_CLOCK_HZ。
+ */
+static void MyI2C_Calibrate(void){
+	uint32_t t0, t1, HalfPeriod, PerLoop;
+
+	MyDWT_Init();
+
+	MyI2C_DelayLoops = 0;
+	t0 = MyDWT_GetCycles();
+	MyI2C_Delay();
+	t0 = MyDWT_GetCycles() - t0;
+
+	MyI2C_DelayLoops = 100;
+	t1 = MyDWT_GetCycles();
+	MyI2C_Delay();
+	t1 = MyDWT_GetCycles() - t1;
+
+	PerLoop = (t1 - t0) / 100;
+	if(PerLoop == 0){
+		PerLoop = 1;
+	}
+
+	HalfPeriod = (SystemCoreClock / MYI2C_CLOCK_HZ * 13 + 24) / 25;
+	MyI2C_DelayLoops = HalfPeriod > t0 ? (HalfPeriod - t0 + PerLoop - 1) / PerLoop : 0;
+}
+#endif
+
+/**
+ * @brief  释放 SCL 并等待其变为高电平（从机可拉低 SCL 进行时钟延展）
+ * @retval MYI2C_OK / MYI2C_TIMEOUT_ERR
+ */
+static uint8_t MyI2C_SCL_H(void){
+	uint32_t Timeout = MYI2C_TIMEOUT;
+
+	MYI2C_PORT->BSRR = MYI2C_SCL;
+	while(!MyI2C_SCL_Read()){
+		if(--Timeout == 0){
+			return MYI2C_TIMEOUT_ERR;
+		}
+	}
+	MyI2C_Delay();
+	return MYI2C_OK;
+}
+
+/**
+ * @brief  起始 / 重复起始
+ * @note   进入时 SCL 可为高（空闲）或低（重复起始），退出时 SCL 为低。
+ */
+static uint8_t MyI2C_Start(void){
+	MyI2C_SDA_H();
+	if(MyI2C_SCL_H() != MYI2C_OK){
+		return MYI2C_TIMEOUT_ERR;
+	}
+	MyI2C_SDA_L();
+	MyI2C_Delay();
+	MyI2C_SCL_L();
+	MyI2C_Delay();
+	return MYI2C_OK;
+}
+
+/**
+ * @brief  终止，释放总线
+ */
+static void MyI2C_Stop(void){
+	MyI2C_SDA_L();
+	MyI2C_Delay();
+	MyI2C_SCL_H();                      // 超时也继续释放 SDA
+	MyI2C_SDA_H();
+	MyI2C_Delay();
+}
+
+/**
+ * @brief  发送一个字节并读取应答
+ * @retval MYI2C_OK / MYI2C_NACK / MYI2C_TIMEOUT_ERR
+ */
+static uint8_t MyI2C_SendByte(uint8_t Byte){
+	uint8_t i;
+
+	for(i = 0; i < 8; i++){
+		if(Byte & 0x80){
+			MyI2C_SDA_H();
+		}else{
+			MyI2C_SDA_L();
+		}
+		Byte <<= 1;
+		if(MyI2C_SCL_H() != MYI2C_OK){
+			return MYI2C_TIMEOUT_ERR;
+		}
+		MyI2C_SCL_L();
+		MyI2C_Delay();
+	}
+
+	MyI2C_SDA_H();                      // 释放 SDA，由从机应答
+	if(MyI2C_SCL_H() != MYI2C_OK){
+		return MYI2C_TIMEOUT_ERR;
+	}
+	i = MyI2C_SDA_Read() ? MYI2C_NACK : MYI2C_OK;
+	MyI2C_SCL_L();
+	MyI2C_Delay();
+	return i;
+}
+
+/**
+ * @brief  接收一个字节并发送应答
+ * @param  Byte 接收到的数据
+ * @param  Ack  1：应答（继续读取），0：非应答（最后一个字节）
+ */
+static uint8_t MyI2C_ReceiveByte(uint8_t *Byte, uint8_t Ack){
+	uint8_t i, Data = 0;
+
+	MyI2C_SDA_H();                      // 释放 SDA，由从机发送数据
+	for(i = 0; i < 8; i++){
+		if(MyI2C_SCL_H() != MYI2C_OK){
+			return MYI2C_TIMEOUT_ERR;
+		}
+		Data = (Data << 1) | (MyI2C_SDA_Read() ? 1 : 0);
+		MyI2C_SCL_L();
+		MyI2C_Delay();
+	}
+
+	if(Ack){
+		MyI2C_SDA_L();
+	}
+	if(MyI2C_SCL_H() != MYI2C_OK){
+		return MYI2C_TIMEOUT_ERR;
+	}
+	MyI2C_SCL_L();
+	MyI2C_Delay();
+	*Byte = Data;
+	return MYI2C_OK;
+}
+
+/**
+ * @brief  执行一个事务（软件 I2C）
+ * @retval MYI2C_OK / MYI2C_NACK / MYI2C_TIMEOUT_ERR
+ */
+static uint8_t MyI2C_Execute(MyI2C_Xfer_t *Xfer){
+	uint8_t Status = MYI2C_OK;
+	uint16_t i;
+
+	// 写阶段：仅在有数据要写或没有数据要读时执行（后者用于探测从机）
+	if((Xfer->Flags & MYI2C_FLAG_REG) || Xfer->TxCount || Xfer->RxCount == 0){
+		Status = MyI2C_Start();
+		if(Status == MYI2C_OK){
+			Status = MyI2C_SendByte(Xfer->Addr & 0xFE);
+		}
+		if(Status == MYI2C_OK && (Xfer->Flags & MYI2C_FLAG_REG)){
+			Status = MyI2C_SendByte(Xfer->Reg);
+		}
+		for(i = 0; Status == MYI2C_OK && i < Xfer->TxCount; i++){
+			Status = MyI2C_SendByte(Xfer->TxData[i]);
+		}
+	}
+
+	// 读阶段：重复起始后读取，最后一个字节回复 NACK
+	if(Status == MYI2C_OK && Xfer->RxCount){
+		Status = MyI2C_Start();
+		if(Status == MYI2C_OK){
+			Status = MyI2C_SendByte(Xfer->Addr | 0x01);
+		}
+		for(i = 0; Status == MYI2C_OK && i < Xfer->RxCount; i++){
+			Status = MyI2C_ReceiveByte(&Xfer->RxData[i], i + 1 < Xfer->RxCount);
+		}
+	}
+
+	MyI2C_Stop();
+	return Status;
+}
+
+/**
+ * @brief  初始化软件 I2C 引脚（开漏输出，释放总线）
+ */
+void MyI2C_Init(void){
+	GPIO_InitTypeDef GPIO_InitStructure;
+
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
+
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_OD;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_InitStructure.GPIO_Pin = MYI2C_SCL | MYI2C_SDA;
+	GPIO_Init(MYI2C_PORT, &GPIO_InitStructure);
+
+	MYI2C_PORT->BSRR = MYI2C_SCL | MYI2C_SDA;
+	MyI2C_Head = MyI2C_Tail = 0;
+
+#ifndef MYI2C_DELAY_LOOPS
+	MyI2C_Calibrate();
+#endif
+}
+
+#else
+
+/* ============================== 硬件 I2C ============================== */
+
+/**
+ * @brief  配置 I2C1 外设
+ */
+static void MyI2C_HardInit(void){
+	I2C_InitTypeDef I2C_InitStructure;
+
+	I2C_InitStructure.I2C_Mode = I2C_Mode_I2C;
+	I2C_InitStructure.I2C_ClockSpeed = MYI2C_CLOCK_HZ;
+	I2C_InitStructure.I2C_DutyCycle = I2C_DutyCycle_2;
+	I2C_InitStructure.I2C_Ack = I2C_Ack_Enable;
+	I2C_InitStructure.I2C_AcknowledgedAddress = I2C_AcknowledgedAddress_7bit;
+	I2C_InitStructure.I2C_OwnAddress1 = 0x00;
+	I2C_Init(I2C1, &I2C_InitStructure);
+
+	I2C_Cmd(I2C1, ENABLE);
+}
+
+/**
+ * @brief  等待硬件事件，同时检查应答失败
+ * @retval MYI2C_OK / MYI2C_NACK / MYI2C_TIMEOUT_ERR
+ */
+static uint8_t MyI2C_WaitEvent(uint32_t Event){
+	uint32_t Timeout = MYI2C_TIMEOUT;
+
+	while(I2C_CheckEvent(I2C1, Event) != SUCCESS){
+		if(I2C_GetFlagStatus(I2C1, I2C_FLAG_AF) == SET){
+			I2C_ClearFlag(I2C1, I2C_FLAG_AF);
+			return MYI2C_NACK;
+		}
+		if(--Timeout == 0){
+			return MYI2C_TIMEOUT_ERR;
+		}
+	}
+	return MYI2C_OK;
+}
+
+/**
+ * @brief  执行一个事务（硬件 I2C）
+ * @note   时钟延展由外设自动处理；超时后复位外设以解除总线锁死。
+ * @retval MYI2C_OK / MYI2C_NACK / MYI2C_TIMEOUT_ERR
+ */
+static uint8_t MyI2C_Execute(MyI2C_Xfer_t *Xfer){
+	uint8_t Status = MYI2C_OK;
+	uint8_t Stopped = 0;
+	uint16_t i;
+
+	// 写阶段
+	if((Xfer->Flags & MYI2C_FLAG_REG) || Xfer->TxCount || Xfer->RxCount == 0){
+		I2C_GenerateSTART(I2C1, ENABLE);
+		Status = MyI2C_WaitEvent(I2C_EVENT_MASTER_MODE_SELECT);
+		if(Status == MYI2C_OK){
+			I2C_Send7bitAddress(I2C1, Xfer->Addr & 0xFE, I2C_Direction_Transmitter);
+			Status = MyI2C_WaitEvent(I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED);
+		}
+		if(Status == MYI2C_OK && (Xfer->Flags & MYI2C_FLAG_REG)){
+			I2C_SendData(I2C1, Xfer->Reg);
+			Status = MyI2C_WaitEvent(I2C_EVENT_MASTER_BYTE_TRANSMITTING);
+		}
+		for(i = 0; Status == MYI2C_OK && i < Xfer->TxCount; i++){
+			I2C_SendData(I2C1, Xfer->TxData[i]);
+			Status = MyI2C_WaitEvent(I2C_EVENT_MASTER_BYTE_TRANSMITTING);
+		}
+		if(Status == MYI2C_OK){
+			Status = MyI2C_WaitEvent(I2C_EVENT_MASTER_BYTE_TRANSMITTED);
+		}
+	}
+
+	// 读阶段：在接收最后一个字节前关闭应答并预置终止条件
+	if(Status == MYI2C_OK && Xfer->RxCount){
+		I2C_GenerateSTART(I2C1, ENABLE);
+		Status = MyI2C_WaitEvent(I2C_EVENT_MASTER_MODE_SELECT);
+		if(Status == MYI2C_OK){
+			I2C_Send7bitAddress(I2C1, Xfer->Addr | 0x01, I2C_Direction_Receiver);
+			Status = MyI2C_WaitEvent(I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED);
+		}
+		for(i = 0; Status == MYI2C_OK && i < Xfer->RxCount; i++){
+			if(i + 1 == Xfer->RxCount){
+				I2C_AcknowledgeConfig(I2C1, DISABLE);
+				I2C_GenerateSTOP(I2C1, ENABLE);
+				Stopped = 1;
+			}
+			Status = MyI2C_WaitEvent(I2C_EVENT_MASTER_BYTE_RECEIVED);
+			if(Status == MYI2C_OK){
+				Xfer->RxData[i] = I2C_ReceiveData(I2C1);
+			}
+		}
+		I2C_AcknowledgeConfig(I2C1, ENABLE);
+	}
+
+	if(!Stopped){
+		I2C_GenerateSTOP(I2C1, ENABLE);
+	}
+	if(Status == MYI2C_TIMEOUT_ERR){
+		I2C_SoftwareResetCmd(I2C1, ENABLE);
+		I2C_SoftwareResetCmd(I2C1, DISABLE);
+		MyI2C_HardInit();
+	}
+	return Status;
+}
+
+/**
+ * @brief  初始化硬件 I2C1（重映射到 PB8 / PB9，复用开漏）
+ */
+void MyI2C_Init(void){
+	GPIO_InitTypeDef GPIO_InitStructure;
+
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB | RCC_APB2Periph_AFIO, ENABLE);
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_I2C1, ENABLE);
+	GPIO_PinRemapConfig(GPIO_Remap_I2C1, ENABLE);
+
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_OD;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8 | GPIO_Pin_9;
+	GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+	MyI2C_HardInit();
+	MyI2C_Head = MyI2C_Tail = 0;
+}
+
+#endif
+
+/* ============================== 事务队列 ============================== */
+
+/**
+ * @brief  提交一个事务，立即返回
+ * @param  Xfer 事务描述，完成前必须保持有效且不被修改
+ * @retval MYI2C_OK：已入队；MYI2C_FULL：队列已满
+ */
+uint8_t MyI2C_Submit(MyI2C_Xfer_t *Xfer){
+	if((uint8_t)(MyI2C_Tail - MyI2C_Head) >= MYI2C_QUEUE_SIZE){
+		return MYI2C_FULL;
+	}
+	Xfer->Status = MYI2C_PENDING;
+	MyI2C_Queue[MyI2C_Tail & (MYI2C_QUEUE_SIZE - 1)] = Xfer;
+	MyI2C_Tail++;
+	return MYI2C_OK;
+}
+
+/**
+ * @brief  执行队列中的下一个事务，并调用其完成回调
+ * @note   在主循环中反复调用；回调中可以再次提交事务。
+ * @retval 1：执行了一个事务；0：队列为空
+ */
+uint8_t MyI2C_Process(void){
+	MyI2C_Xfer_t *Xfer;
+
+	if(MyI2C_Head == MyI2C_Tail){
+		return 0;
+	}
+	Xfer = MyI2C_Queue[MyI2C_Head & (MYI2C_QUEUE_SIZE - 1)];
+	MyI2C_Head++;
+
+	Xfer->Status = MyI2C_Execute(Xfer);
+	if(Xfer->Callback){
+		Xfer->Callback(Xfer);
+	}
+	return 1;
+}
+
+/**
+ * @brief  提交事务并等待其完成
+ * @note   排在它前面的事务会先被执行，因此阻塞调用也不会饿死已提交的读取。
+ * @retval 事务最终状态
+ */
+uint8_t MyI2C_Transfer(MyI2C_Xfer_t *Xfer){
+	while(MyI2C_Submit(Xfer) != MYI2C_OK){
+		MyI2C_Process();
+	}
+	while(Xfer->Status == MYI2C_PENDING){
+		MyI2C_Process();
+	}
+	return Xfer->Status;
+}
+
+/**
+ * @brief  阻塞式写：起始 -> 地址 -> Data... -> 终止
+ */
+uint8_t MyI2C_Write(uint8_t Addr, const uint8_t *Data, uint16_t Count){
+	MyI2C_Xfer_t Xfer = {0};
+
+	Xfer.Addr = Addr;
+	Xfer.TxData = Data;
+	Xfer.TxCount = Count;
+	return MyI2C_Transfer(&Xfer);
+}
+
+/**
+ * @brief  阻塞式读：起始 -> 读地址 -> Data... -> 终止
+ */
+uint8_t MyI2C_Read(uint8_t Addr, uint8_t *Data, uint16_t Count){
+	MyI2C_Xfer_t Xfer = {0};
+
+	Xfer.Addr = Addr;
+	Xfer.RxData = Data;
+	Xfer.RxCount = Count;
+	return MyI2C_Transfer(&Xfer);
+}
+
+/**
+ * @brief  阻塞式写寄存器：起始 -> 地址 -> Reg -> Data... -> 终止
+ */
+uint8_t MyI2C_WriteReg(uint8_t Addr, uint8_t Reg, const uint8_t *Data, uint16_t Count){
+	MyI2C_Xfer_t Xfer = {0};
+
+	Xfer.Addr = Addr;
+	Xfer.Flags = MYI2C_FLAG_REG;
+	Xfer.Reg = Reg;
+	Xfer.TxData = Data;
+	Xfer.TxCount = Count;
+	return MyI2C_Transfer(&Xfer);
+}
+
+/**
+ * @brief  阻塞式读寄存器：起始 -> 地址 -> Reg -> 重复起始 -> 读地址 -> Data... -> 终止
+ */
+uint8_t MyI2C_ReadReg(uint8_t Addr, uint8_t Reg, uint8_t *Data, uint16_t Count){
+	MyI2C_Xfer_t Xfer = {0};
+
+	Xfer.Addr = Addr;
+	Xfer.Flags = MYI2C_FLAG_REG;
+	Xfer.Reg = Reg;
+	Xfer.RxData = Data;
+	Xfer.RxCount = Count;
+	return MyI2C_Transfer(&Xfer);
+}
@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file    MyI2C.h
+ * @brief   通用 I2C 主机总线驱动头文件（软件 / 硬件两种实现）
+ * @note    声明传输描述结构、事务队列与阻塞式读写接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 默认使用软件 I2C，SCL：PB8，SDA：PB9（与 OLED 共用总线）；
+ * - 定义 MYI2C_HARDWARE 时改用硬件 I2C1，引脚重映射到 PB8 / PB9；
+ *   此时 OLED 必须在 OLED.h 中定义 OLED_I2C_BUS，经本模块访问总线；
+ * - 地址参数均为 8 位写地址（如 OLED 为 0x78，MPU6050 为 0xD0）；
+ * - 所有函数只能在主循环（非中断）上下文中调用。
+ ******************************************************************************
+ */
+
+#ifndef __MYI2C_H
+#define __MYI2C_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+//#define MYI2C_HARDWARE                ///< 定义此宏使用硬件 I2C1，否则使用软件 I2C
+
+#ifndef MYI2C_CLOCK_HZ
+#define MYI2C_CLOCK_HZ      400000      ///< SCL 频率（硬件 I2C 直接配置，软件 I2C 用于校准延时）
+#endif
+
+//#define MYI2C_DELAY_LOOPS   5           ///< 定义此宏使用固定的软件 I2C 半周期延时循环次数，不再校准
+
+#ifndef MYI2C_TIMEOUT
+#define MYI2C_TIMEOUT       10000       ///< 等待时钟延展 / 硬件事件的最大循环次数
+#endif
+
+#ifndef MYI2C_QUEUE_SIZE
+#define MYI2C_QUEUE_SIZE    8           ///< 事务队列容量（必须为 2 的幂）
+#endif
+
+/* 传输状态 -----------------------------------------------------------------*/
+#define MYI2C_OK            0           ///< 传输成功
+#define MYI2C_NACK          1           ///< 从机无应答（地址或数据）
+#define MYI2C_TIMEOUT_ERR   2           ///< 时钟延展或硬件事件超时
+#define MYI2C_FULL          3           ///< 事务队列已满
+#define MYI2C_PENDING       0xFF        ///< 已提交，尚未完成
+
+/* 传输标志 -----------------------------------------------------------------*/
+#define MYI2C_FLAG_REG      0x01        ///< 在地址之后先发送 Reg 字节（寄存器地址 / 控制字节）
+
+/* 传输描述 -----------------------------------------------------------------*/
+typedef struct MyI2C_Xfer MyI2C_Xfer_t;
+
+/**
+ * 一次完整的总线事务：
+ *   起始 -> 写地址 -> [Reg] -> TxData... -> [重复起始 -> 读地址 -> RxData...] -> 终止
+ * 写阶段为空（无 Reg、TxCount 为 0）时直接从读地址开始。
+ */
+struct MyI2C_Xfer
+{
+	uint8_t Addr;                       ///< 8 位写地址
+	uint8_t Flags;                      ///< 传输标志（MYI2C_FLAG_xxx）
+	uint8_t Reg;                        ///< MYI2C_FLAG_REG 时发送的第一个字节
+	const uint8_t *TxData;              ///< 写数据
+	uint16_t TxCount;                   ///< 写数据数量
+	uint8_t *RxData;                    ///< 读数据缓冲区
+	uint16_t RxCount;                   ///< 读数据数量
+	void (*Callback)(MyI2C_Xfer_t *Xfer);   ///< 完成回调，可为 NULL
+	volatile uint8_t Status;            ///< 传输状态（MYI2C_OK 等）
+};
+
+/* 函数声明 -----------------------------------------------------------------*/
+void MyI2C_Init(void);
+
+/* 事务队列 */
+uint8_t MyI2C_Submit(MyI2C_Xfer_t *Xfer);
+uint8_t MyI2C_Process(void);
+uint8_t MyI2C_Transfer(MyI2C_Xfer_t *Xfer);
+
+/* 阻塞式读写 */
+uint8_t MyI2C_Write(uint8_t Addr, const uint8_t *Data, uint16_t Count);
+uint8_t MyI2C_Read(uint8_t Addr, uint8_t *Data, uint16_t Count);
+uint8_t MyI2C_WriteReg(uint8_t Addr, uint8_t Reg, const uint8_t *Data, uint16_t Count);
+uint8_t MyI2C_ReadReg(uint8_t Addr, uint8_t Reg, uint8_t *Data, uint16_t Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MYI2C_H */
@@ -18,13 +18,25 @@
   ***************************************************************************************
   */
 
+#ifndef OLED_HOST_SIM
 #include "stm32f10x.h"
+#endif
 #include "OLED.h"
 #include <string.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdarg.h>
+#ifdef OLED_HOST_SIM
+#include "OLED_Sim.h"			//主机仿真：传输层为模拟的SSD1306
+#else
 #include <Delay.h>
+#endif
+#ifdef OLED_I2C_BUS
+#include "MyI2C.h"
+#endif
+#if (defined(OLED_STATS) || defined(OLED_I2C_FAST)) && !defined(OLED_HOST_SIM)
+#include "MyDWT.h"			//传输统计与快速I2C延时校准使用DWT周期计数器
+#endif
 
 /**
   * 数据存储格式：
@@ -79,12 +91,85 @@
   * 所有的显示函数，都只是对此显存数组进行读写
   * 随后调用OLED_Update函数或OLED_UpdateArea函数
   * 才会将显存数组的数据发送到OLED硬件，进行显示
+  * 此指针指向当前屏幕的显存，调用OLED_Select切换屏幕时随之改变
+  */
+static uint8_t OLED_DefaultBuf[OLED_PAGES][OLED_WIDTH];
+uint8_t (*OLED_DisplayBuf)[OLED_WIDTH] = OLED_DefaultBuf;
+
+/*默认传输函数，定义在通信协议部分；主机仿真时为OLED_Sim_Write*/
+#ifdef OLED_HOST_SIM
+#define OLED_I2C_Write		OLED_Sim_Write
+#else
+static void OLED_I2C_Write(uint8_t Address, uint8_t Control, const uint8_t *Data, uint8_t Count);
+#endif
+
+/**
+  * OLED屏幕实例
+  * 默认屏幕由OLED_Init初始化，其他屏幕由OLED_PanelInit初始化
+  * 所有显示函数都作用于OLED_Current指向的当前屏幕
+  */
+OLED_Panel_t OLED_DefaultPanel = {OLED_DefaultBuf, 0x78, OLED_ROTATE_0, OLED_I2C_Write};
+OLED_Panel_t *OLED_Current = &OLED_DefaultPanel;
+OLED_Panel_t *OLED_PanelList;		//已初始化屏幕的链表，供刷新调度遍历
+
+/**
+  * 旋转90/270度时，逻辑坐标的X、Y在写入显存前互换
+  * 以下宏供绘图函数使用，正常方向时只多一次判断
+  */
+#define OLED_TRANSPOSED			(OLED_Current->Orientation & OLED_TRANSPOSE)
+#define OLED_SWAP(A, B)			do {int16_t Temp = (A); (A) = (B); (B) = Temp;} while (0)
+
+/**
+  * 裁剪与原点
+  * 绘图函数的坐标先加上原点，再与裁剪矩形求交，之后的内层循环不再逐点判断边界
+  * 裁剪矩形为加上原点后的逻辑坐标（含边界），默认不限制，绘制时再与屏幕求交
+  */
+typedef struct
+{
+	int16_t OriginX, OriginY;
+	int16_t ClipX0, ClipY0, ClipX1, ClipY1;
+} OLED_View_t;
+
+#define OLED_VIEW_NONE			{0, 0, -32768, -32768, 32767, 32767}
+
+static OLED_View_t OLED_View = OLED_VIEW_NONE;
+static OLED_View_t OLED_ViewStack[OLED_VIEW_DEPTH];
+static uint8_t OLED_ViewDepth;
+
+/*本次绘制的有效裁剪区域，即裁剪矩形与屏幕的交集，由OLED_ClipUpdate计算*/
+static int16_t OLED_CX0, OLED_CY0, OLED_CX1, OLED_CY1;
+static uint8_t OLED_ClipNeeded;		//图形部分超出有效裁剪区域，OLED_Plot需要逐点判断
+
+/*OLED_FillRect的操作*/
+#define OLED_OP_SET				0
+#define OLED_OP_CLEAR			1
+#define OLED_OP_XOR				2
+
+/**
+  * OLED传输统计
+  * 未定义OLED_STATS时，以下宏均为空，统计变量也不存在
   */
-uint8_t OLED_DisplayBuf[8][128];
+#ifdef OLED_STATS
+static OLED_Stats_t OLED_Stats;
+#ifdef OLED_HOST_SIM
+#define OLED_STATS_NOW()			0					//主机仿真时不计周期
+#else
+#define OLED_STATS_NOW()			MyDWT_GetCycles()
+#endif
+#define OLED_STATS_START()			uint32_t StatsStart = OLED_STATS_NOW()
+#define OLED_STATS_ADD(Field, N)	(OLED_Stats.Field += (N))
+#define OLED_STATS_ELAPSED()		(OLED_STATS_NOW() - StatsStart)
+#else
+#define OLED_STATS_START()
+#define OLED_STATS_ADD(Field, N)
+#define OLED_STATS_ELAPSED()		0
+#endif
 
 /*********************全局变量*/
 
 
+#ifndef OLED_HOST_SIM		//主机仿真时不编译引脚配置与通信协议
+
 /*引脚配置*********************/
 
 /**
@@ -121,6 +206,10 @@ void OLED_W_SDA(uint8_t BitValue)
 	//...
 }
 
+#ifdef OLED_I2C_FAST
+void OLED_I2C_Calibrate(void);	//定义在通信协议部分
+#endif
+
 /**
   * 函    数：OLED引脚初始化
   * 参    数：无
@@ -152,6 +241,12 @@ void OLED_GPIO_Init(void)
 	/*释放SCL和SDA*/
 	OLED_W_SCL(1);
 	OLED_W_SDA(1);
+	
+#ifdef OLED_I2C_BUS
+	MyI2C_Init();				//由MyI2C模块接管总线
+#elif defined(OLED_I2C_FAST)
+	OLED_I2C_Calibrate();		//按OLED_I2C_CLOCK_HZ校准快速软件I2C的延时
+#endif
 }
 
 /*********************引脚配置*/
@@ -159,6 +254,155 @@ void OLED_GPIO_Init(void)
 
 /*通信协议*********************/
 
+#ifdef OLED_I2C_FAST		//快速软件I2C
+
+/*SCL使用BSRR/BRR寄存器置位/复位，SDA使用Cortex-M3位带别名直接写入Bit值*/
+/*每次写引脚只需一条存储指令，没有函数调用、参数检查和分支*/
+#define OLED_SCL_H()		(GPIOB->BSRR = GPIO_Pin_8)
+#define OLED_SCL_L()		(GPIOB->BRR = GPIO_Pin_8)
+#define OLED_SDA_H()		(GPIOB->BSRR = GPIO_Pin_9)
+#define OLED_SDA_L()		(GPIOB->BRR = GPIO_Pin_9)
+#define OLED_SDA_BB			(*(volatile uint32_t *)(PERIPH_BB_BASE + (GPIOB_BASE + 0x0C - PERIPH_BASE) * 32 + 9 * 4))
+
+/*半个SCL周期的延时循环次数，由OLED_I2C_Calibrate根据OLED_I2C_CLOCK_HZ计算*/
+static uint32_t OLED_I2C_DelayLoops;
+
+/**
+  * 函    数：I2C半周期延时
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：默认实现为校准过的空循环，用户可在OLED.h或编译选项中定义OLED_I2C_DELAY()替换，
+  *           例如定义为空，以不加延时的最快速度运行
+  */
+static __inline void OLED_I2C_Delay(void)
+{
+	volatile uint32_t n = OLED_I2C_DelayLoops;
+	while (n --);
+}
+
+#ifndef OLED_I2C_DELAY
+#define OLED_I2C_DELAY()	OLED_I2C_Delay()
+#endif
+
+/**
+  * 函    数：校准I2C延时
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：使用DWT周期计数器测量延时循环的实际耗时，
+  *           计算出使SCL频率不超过OLED_I2C_CLOCK_HZ的循环次数
+  *           快速模式要求SCL低电平不短于1.3us（周期的52%），与MyI2C相同，
+  *           高、低电平都按52%周期计算，实际频率略低于OLED_I2C_CLOCK_HZ
+  */
+void OLED_I2C_Calibrate(void)
+{
+	uint32_t t0, t1, HalfPeriod, PerLoop;
+	
+	MyDWT_Init();									//使能并启动DWT周期计数器
+	
+	/*测量0次循环的固定开销与100次循环的耗时*/
+	OLED_I2C_DelayLoops = 0;
+	t0 = MyDWT_GetCycles();
+	OLED_I2C_Delay();
+	t0 = MyDWT_GetCycles() - t0;
+	
+	OLED_I2C_DelayLoops = 100;
+	t1 = MyDWT_GetCycles();
+	OLED_I2C_Delay();
+	t1 = MyDWT_GetCycles() - t1;
+	
+	PerLoop = (t1 - t0) / 100;
+	if (PerLoop == 0) {PerLoop = 1;}
+	
+	/*52%个SCL周期所需的CPU周期数，扣除固定开销后向上取整为循环次数*/
+	HalfPeriod = (SystemCoreClock / OLED_I2C_CLOCK_HZ * 13 + 24) / 25;
+	OLED_I2C_DelayLoops = HalfPeriod > t0 ? (HalfPeriod - t0 + PerLoop - 1) / PerLoop : 0;
+}
+
+/**
+  * 函    数：I2C起始
+  * 参    数：无
+  * 返 回 值：无
+  */
+void OLED_I2C_Start(void)
+{
+	OLED_SDA_H();
+	OLED_SCL_H();
+	OLED_I2C_DELAY();
+	OLED_SDA_L();		//在SCL高电平期间，拉低SDA，产生起始信号
+	OLED_I2C_DELAY();
+	OLED_SCL_L();
+}
+
+/**
+  * 函    数：I2C终止
+  * 参    数：无
+  * 返 回 值：无
+  */
+void OLED_I2C_Stop(void)
+{
+	OLED_SDA_L();
+	OLED_I2C_DELAY();
+	OLED_SCL_H();
+	OLED_I2C_DELAY();
+	OLED_SDA_H();		//在SCL高电平期间，释放SDA，产生终止信号
+	OLED_I2C_DELAY();
+}
+
+/*发送一位：SCL低电平期间写SDA，随后一个SCL高电平脉冲*/
+#define OLED_I2C_BIT(Byte, n)	\
+	do {OLED_SDA_BB = ((Byte) >> (n)) & 0x01; OLED_I2C_DELAY(); OLED_SCL_H(); OLED_I2C_DELAY(); OLED_SCL_L();} while (0)
+
+/**
+  * 函    数：I2C发送一个字节
+  * 参    数：Byte 要发送的一个字节数据，范围：0x00~0xFF
+  * 返 回 值：无
+  * 说    明：8位完全展开，第9个时钟释放SDA，不处理应答信号
+  */
+static __inline void OLED_I2C_SendByteFast(uint8_t Byte)
+{
+	OLED_I2C_BIT(Byte, 7);
+	OLED_I2C_BIT(Byte, 6);
+	OLED_I2C_BIT(Byte, 5);
+	OLED_I2C_BIT(Byte, 4);
+	OLED_I2C_BIT(Byte, 3);
+	OLED_I2C_BIT(Byte, 2);
+	OLED_I2C_BIT(Byte, 1);
+	OLED_I2C_BIT(Byte, 0);
+	
+	OLED_SDA_H();		//额外的一个时钟，不处理应答信号
+	OLED_I2C_DELAY();
+	OLED_SCL_H();
+	OLED_I2C_DELAY();
+	OLED_SCL_L();
+}
+
+/**
+  * 函    数：I2C发送一个字节
+  * 参    数：Byte 要发送的一个字节数据，范围：0x00~0xFF
+  * 返 回 值：无
+  */
+void OLED_I2C_SendByte(uint8_t Byte)
+{
+	OLED_I2C_SendByteFast(Byte);
+}
+
+/**
+  * 函    数：I2C连续发送多个字节
+  * 参    数：Data 要发送数据的起始地址
+  * 参    数：Count 要发送数据的数量
+  * 返 回 值：无
+  * 说    明：在一个函数内连续发送整个缓冲区，每字节没有额外的函数调用
+  */
+void OLED_I2C_SendBuffer(const uint8_t *Data, uint16_t Count)
+{
+	while (Count --)
+	{
+		OLED_I2C_SendByteFast(*Data ++);
+	}
+}
+
+#else				//通用软件I2C
+
 /**
   * 函    数：I2C起始
   * 参    数：无
@@ -207,18 +451,58 @@ void OLED_I2C_SendByte(uint8_t Byte)
 	OLED_W_SCL(0);
 }
 
+/**
+  * 函    数：I2C连续发送多个字节
+  * 参    数：Data 要发送数据的起始地址
+  * 参    数：Count 要发送数据的数量
+  * 返 回 值：无
+  */
+void OLED_I2C_SendBuffer(const uint8_t *Data, uint16_t Count)
+{
+	while (Count --)
+	{
+		OLED_I2C_SendByte(*Data ++);
+	}
+}
+
+#endif
+
+/**
+  * 函    数：OLED默认传输函数
+  * 参    数：Address 屏幕的I2C从机地址（8位写地址）
+  * 参    数：Control 控制字节，0x00表示写命令，0x40表示写数据
+  * 参    数：Data 要写入数据的起始地址
+  * 参    数：Count 要写入数据的数量
+  * 返 回 值：无
+  */
+static void OLED_I2C_Write(uint8_t Address, uint8_t Control, const uint8_t *Data, uint8_t Count)
+{
+#ifdef OLED_I2C_BUS
+	MyI2C_WriteReg(Address, Control, Data, Count);	//经总线队列发送
+#else
+	OLED_I2C_Start();				//I2C起始
+	OLED_I2C_SendByte(Address);		//发送OLED的I2C从机地址
+	OLED_I2C_SendByte(Control);		//控制字节
+	OLED_I2C_SendBuffer(Data, Count);	//连续写入Count个数据
+	OLED_I2C_Stop();				//I2C终止
+#endif
+}
+
+#endif	/*OLED_HOST_SIM*/
+
 /**
   * 函    数：OLED写命令
   * 参    数：Command 要写入的命令值，范围：0x00~0xFF
   * 返 回 值：无
+  * 说    明：写入当前屏幕
   */
 void OLED_WriteCommand(uint8_t Command)
 {
-	OLED_I2C_Start();				//I2C起始
-	OLED_I2C_SendByte(0x78);		//发送OLED的I2C从机地址
-	OLED_I2C_SendByte(0x00);		//控制字节，给0x00，表示即将写命令
-	OLED_I2C_SendByte(Command);		//写入指定的命令
-	OLED_I2C_Stop();				//I2C终止
+	OLED_STATS_START();
+	OLED_Current->Write(OLED_Current->Address, 0x00, &Command, 1);	//控制字节0x00，表示写命令
+	OLED_STATS_ADD(Transactions, 1);
+	OLED_STATS_ADD(CommandBytes, 1);
+	OLED_STATS_ADD(Cycles, OLED_STATS_ELAPSED());
 }
 
 /**
@@ -229,21 +513,17 @@ void OLED_WriteCommand(uint8_t Command)
   */
 void OLED_WriteData(uint8_t *Data, uint8_t Count)
 {
-	uint8_t i;
-	
-	OLED_I2C_Start();				//I2C起始
-	OLED_I2C_SendByte(0x78);		//发送OLED的I2C从机地址
-	OLED_I2C_SendByte(0x40);		//控制字节，给0x40，表示即将写数据
-	/*循环Count次，进行连续的数据写入*/
-	for (i = 0; i < Count; i ++)
-	{
-		OLED_I2C_SendByte(Data[i]);	//依次发送Data的每一个数据
-	}
-	OLED_I2C_Stop();				//I2C终止
+	OLED_STATS_START();
+	OLED_Current->Write(OLED_Current->Address, 0x40, Data, Count);	//控制字节0x40，表示写数据
+	OLED_STATS_ADD(Transactions, 1);
+	OLED_STATS_ADD(DataBytes, Count);
+	OLED_STATS_ADD(Cycles, OLED_STATS_ELAPSED());
 }
 
 /*********************通信协议*/
 
+#ifndef OLED_HOST_SIM
+
 /* changed by jeffrey, SPI 2 IIC OLED ***********************/
 
 void OLED_SPI2IIC(void){
@@ -267,6 +547,8 @@ void OLED_SPI2IIC(void){
 }
 /*********************** changed by jeffrey, SPI 2 IIC OLED*/
 
+#endif	/*OLED_HOST_SIM*/
+
 
 
 /*硬件配置*********************/
@@ -279,10 +561,55 @@ void OLED_SPI2IIC(void){
   */
 void OLED_Init(void)
 {
+#ifndef OLED_HOST_SIM
 	/* changed by jeffrey, SPI 2 IIC OLED */
 	OLED_SPI2IIC();
 	
 	OLED_GPIO_Init();			//先调用底层的端口初始化
+#ifdef OLED_STATS
+	MyDWT_Init();				//统计传输周期数需要DWT周期计数器
+#endif
+#endif
+	
+	OLED_PanelInit(&OLED_DefaultPanel, OLED_DefaultBuf, 0x78, OLED_DefaultPanel.Orientation, OLED_DefaultPanel.Write);	//初始化默认屏幕
+}
+
+/**
+  * 函    数：OLED屏幕初始化
+  * 参    数：Panel 屏幕实例，由调用者提供存储空间
+  * 参    数：Buf 此屏幕的显存数组，OLED_PAGES页 x OLED_WIDTH列
+  * 参    数：Address 屏幕的I2C从机地址（8位写地址），范围：0x78/0x7A
+  * 参    数：Orientation 屏幕方向，OLED_ROTATE_0等，初始化时即按此方向配置
+  * 参    数：Write 传输函数，传入0时使用默认I2C
+  * 返 回 值：无
+  * 说    明：多块屏幕共用同一总线时，先调用OLED_Init，再对其余屏幕调用此函数
+  *           Panel的所有成员都在此写入，可以是未初始化的局部变量或全局变量
+  *           此函数执行后，Panel成为当前屏幕，可用OLED_Select切换回其他屏幕
+  */
+void OLED_PanelInit(OLED_Panel_t *Panel, uint8_t (*Buf)[OLED_WIDTH], uint8_t Address, uint8_t Orientation, OLED_Write_t Write)
+{
+	OLED_Panel_t *p;
+	uint8_t j;
+	
+	Panel->Buf = Buf;
+	Panel->Address = Address;
+	Panel->Orientation = Orientation;
+	Panel->Write = Write ? Write : OLED_I2C_Write;	//未指定传输函数时使用默认I2C
+	for (j = 0; j < OLED_PAGES; j ++)
+	{
+		Panel->DirtyMin[j] = OLED_WIDTH;	//所有页无脏区间
+		Panel->DirtyMax[j] = 0;
+	}
+	
+	/*加入屏幕链表，重复初始化时不重复加入*/
+	for (p = OLED_PanelList; p != 0 && p != Panel; p = p->Next);
+	if (p == 0)
+	{
+		Panel->Next = OLED_PanelList;
+		OLED_PanelList = Panel;
+	}
+	
+	OLED_Select(Panel);
 	
 	/*写入一系列的命令，对OLED进行初始化配置*/
 	OLED_WriteCommand(0xAE);	//设置显示开启/关闭，0xAE关闭，0xAF开启
@@ -291,19 +618,21 @@ void OLED_Init(void)
 	OLED_WriteCommand(0x80);	//0x00~0xFF
 	
 	OLED_WriteCommand(0xA8);	//设置多路复用率
-	OLED_WriteCommand(0x3F);	//0x0E~0x3F
+	OLED_WriteCommand(OLED_HEIGHT - 1);	//0x0E~0x3F，等于屏幕高度减1
 	
 	OLED_WriteCommand(0xD3);	//设置显示偏移
 	OLED_WriteCommand(0x00);	//0x00~0x7F
 	
 	OLED_WriteCommand(0x40);	//设置显示开始行，0x40~0x7F
 	
-	OLED_WriteCommand(0xA1);	//设置左右方向，0xA1正常，0xA0左右反置
+	/*设置左右方向，0xA1正常，0xA0左右反置*/
+	OLED_WriteCommand(Panel->Orientation & OLED_MIRROR_X ? 0xA0 : 0xA1);
 	
-	OLED_WriteCommand(0xC8);	//设置上下方向，0xC8正常，0xC0上下反置
+	/*设置上下方向，0xC8正常，0xC0上下反置*/
+	OLED_WriteCommand(Panel->Orientation & OLED_MIRROR_Y ? 0xC0 : 0xC8);
 
 	OLED_WriteCommand(0xDA);	//设置COM引脚硬件配置
-	OLED_WriteCommand(0x12);
+	OLED_WriteCommand(OLED_HEIGHT == 64 ? 0x12 : 0x02);	//128x64为交替COM，128x32为顺序COM
 	
 	OLED_WriteCommand(0x81);	//设置对比度
 	OLED_WriteCommand(0xCF);	//0x00~0xFF
@@ -327,6 +656,44 @@ void OLED_Init(void)
 	OLED_Update();				//更新显示，清屏，防止初始化后未显示内容时花屏
 }
 
+/**
+  * 函    数：OLED选择当前屏幕
+  * 参    数：Panel 要选择的屏幕实例，必须已经调用过OLED_Init或OLED_PanelInit
+  * 返 回 值：之前的当前屏幕，便于临时切换后恢复
+  * 说    明：之后调用的显示、更新等函数都作用于此屏幕
+  */
+OLED_Panel_t *OLED_Select(OLED_Panel_t *Panel)
+{
+	OLED_Panel_t *Previous = OLED_Current;
+	
+	OLED_Current = Panel;
+	OLED_DisplayBuf = Panel->Buf;	//所有显示函数改为读写此屏幕的显存
+	return Previous;
+}
+
+/**
+  * 函    数：OLED设置当前屏幕的方向
+  * 参    数：Orientation 指定屏幕方向
+  *           范围：OLED_ROTATE_0		正常方向
+  *                 OLED_ROTATE_90		顺时针旋转90度
+  *                 OLED_ROTATE_180		旋转180度
+  *                 OLED_ROTATE_270		顺时针旋转270度
+  *                 OLED_MIRROR_X		左右镜像
+  *                 OLED_MIRROR_Y		上下镜像
+  * 返 回 值：无
+  * 说    明：180度与镜像由SSD1306的段重映射（0xA0/0xA1）和COM扫描方向（0xC0/0xC8）命令实现
+  *           90/270度在此基础上由绘图函数交换X、Y坐标写入显存，逻辑屏幕变为OLED_HEIGHT x OLED_WIDTH
+  *           方向只在设置时发送命令，之后的每帧绘制和刷新没有额外的变换开销
+  *           段重映射只影响之后写入的数据，故设置后需重新绘制并调用OLED_Update
+  *           也可以在OLED_PanelInit的Orientation参数中指定，初始化时即按此方向配置
+  */
+void OLED_SetOrientation(uint8_t Orientation)
+{
+	OLED_Current->Orientation = Orientation;
+	OLED_WriteCommand(Orientation & OLED_MIRROR_X ? 0xA0 : 0xA1);	//左右方向
+	OLED_WriteCommand(Orientation & OLED_MIRROR_Y ? 0xC0 : 0xC8);	//上下方向
+}
+
 /**
   * 函    数：OLED设置显示光标位置
   * 参    数：Page 指定光标所在的页，范围：0~7
@@ -336,11 +703,9 @@ void OLED_Init(void)
   */
 void OLED_SetCursor(uint8_t Page, uint8_t X)
 {
-	/*如果使用此程序驱动1.3寸的OLED显示屏，则需要解除此注释*/
-	/*因为1.3寸的OLED驱动芯片（SH1106）有132列*/
-	/*屏幕的起始列接在了第2列，而不是第0列*/
-	/*所以需要将X加2，才能正常显示*/
-//	X += 2;
+	/*1.3寸的OLED驱动芯片（SH1106）有132列，屏幕的起始列接在了第2列*/
+	/*定义OLED_SH1106时OLED_COL_OFFSET为2，否则为0，由编译器直接折叠*/
+	X += OLED_COL_OFFSET;
 	
 	/*通过指令设置页地址和列地址*/
 	OLED_WriteCommand(0xB0 | Page);					//设置页位置
@@ -355,6 +720,92 @@ void OLED_SetCursor(uint8_t Page, uint8_t X)
 
 /*工具函数仅供内部部分函数使用*/
 
+/**
+  * 函    数：计算有效裁剪区域
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：裁剪矩形与当前屏幕（考虑旋转后的逻辑尺寸）求交，结果存入OLED_CX0等变量
+  */
+static void OLED_ClipUpdate(void)
+{
+	OLED_CX0 = OLED_View.ClipX0 > 0 ? OLED_View.ClipX0 : 0;
+	OLED_CY0 = OLED_View.ClipY0 > 0 ? OLED_View.ClipY0 : 0;
+	OLED_CX1 = OLED_View.ClipX1 < OLED_SCREEN_WIDTH - 1 ? OLED_View.ClipX1 : OLED_SCREEN_WIDTH - 1;
+	OLED_CY1 = OLED_View.ClipY1 < OLED_SCREEN_HEIGHT - 1 ? OLED_View.ClipY1 : OLED_SCREEN_HEIGHT - 1;
+}
+
+/**
+  * 函    数：判断图形的外接矩形与有效裁剪区域的关系
+  * 参    数：X0 Y0 X1 Y1 外接矩形的左上角和右下角，加上原点后的逻辑坐标
+  * 返 回 值：0：完全在裁剪区域外，无需绘制；1：需要绘制
+  * 说    明：同时设置OLED_ClipNeeded，外接矩形完全在区域内时为0，之后的OLED_Plot不再判断边界
+  */
+static uint8_t OLED_ClipTest(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1)
+{
+	OLED_ClipUpdate();
+	if (X1 < OLED_CX0 || X0 > OLED_CX1 || Y1 < OLED_CY0 || Y0 > OLED_CY1) {return 0;}
+	OLED_ClipNeeded = X0 < OLED_CX0 || X1 > OLED_CX1 || Y0 < OLED_CY0 || Y1 > OLED_CY1;
+	return 1;
+}
+
+/**
+  * 函    数：在显存中画一个点（不加原点）
+  * 参    数：X Y 加上原点后的逻辑坐标
+  * 返 回 值：无
+  * 说    明：调用前需先调用OLED_ClipTest，OLED_ClipNeeded为0时不做任何边界判断
+  */
+static void OLED_Plot(int16_t X, int16_t Y)
+{
+	if (OLED_ClipNeeded && (X < OLED_CX0 || X > OLED_CX1 || Y < OLED_CY0 || Y > OLED_CY1)) {return;}
+	if (OLED_TRANSPOSED) {OLED_SWAP(X, Y);}		//逻辑坐标转换为显存坐标
+	OLED_DisplayBuf[Y / 8][X] |= 0x01 << (Y % 8);
+}
+
+/**
+  * 函    数：对显存中的矩形区域置位、清零或取反（不加原点）
+  * 参    数：X0 Y0 X1 Y1 矩形的左上角和右下角，加上原点后的逻辑坐标，X1 < X0时为空
+  * 参    数：Op 操作，范围：OLED_OP_SET/OLED_OP_CLEAR/OLED_OP_XOR
+  * 返 回 值：无
+  * 说    明：调用前需先调用OLED_ClipUpdate或OLED_ClipTest，矩形与有效裁剪区域求交一次后按页整字节写入
+  *           不改变OLED_ClipNeeded，可在逐点绘制的过程中调用
+  */
+static void OLED_FillRect(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint8_t Op)
+{
+	int16_t i, Page, Page1;
+	uint8_t Mask;
+	
+	/*与有效裁剪区域求交*/
+	if (X0 < OLED_CX0) {X0 = OLED_CX0;}
+	if (Y0 < OLED_CY0) {Y0 = OLED_CY0;}
+	if (X1 > OLED_CX1) {X1 = OLED_CX1;}
+	if (Y1 > OLED_CY1) {Y1 = OLED_CY1;}
+	if (X0 > X1 || Y0 > Y1) {return;}
+	
+	if (OLED_TRANSPOSED) {OLED_SWAP(X0, Y0); OLED_SWAP(X1, Y1);}	//逻辑区域转换为显存区域
+	
+	/*逐页处理，首尾两页只操作区域内的Bit*/
+	Page1 = Y1 / 8;
+	for (Page = Y0 / 8; Page <= Page1; Page ++)
+	{
+		Mask = 0xFF;
+		if (Page == Y0 / 8) {Mask &= 0xFF << (Y0 % 8);}
+		if (Page == Page1) {Mask &= 0xFF >> (7 - Y1 % 8);}
+		
+		if (Op == OLED_OP_SET)
+		{
+			for (i = X0; i <= X1; i ++) {OLED_DisplayBuf[Page][i] |= Mask;}
+		}
+		else if (Op == OLED_OP_CLEAR)
+		{
+			for (i = X0; i <= X1; i ++) {OLED_DisplayBuf[Page][i] &= ~Mask;}
+		}
+		else
+		{
+			for (i = X0; i <= X1; i ++) {OLED_DisplayBuf[Page][i] ^= Mask;}
+		}
+	}
+}
+
 /**
   * 函    数：次方函数
   * 参    数：X 底数
@@ -366,64 +817,376 @@ uint32_t OLED_Pow(uint32_t X, uint32_t Y)
 	uint32_t Result = 1;	//结果默认为1
 	while (Y --)			//累乘Y次
 	{
-		Result *= X;		//每次把X累乘到结果上
+		Result *= X;		//每次把X累乘到结果上
+	}
+	return Result;
+}
+
+/**
+  * 函    数：判断指定点是否在指定多边形内部
+  * 参    数：nvert 多边形的顶点数
+  * 参    数：vertx verty 包含多边形顶点的x和y坐标的数组
+  * 参    数：testx testy 测试点的X和y坐标
+  * 返 回 值：指定点是否在指定多边形内部，1：在内部，0：不在内部
+  */
+uint8_t OLED_pnpoly(uint8_t nvert, int16_t *vertx, int16_t *verty, int16_t testx, int16_t testy)
+{
+	int16_t i, j, c = 0;
+	
+	/*此算法由W. Randolph Franklin提出*/
+	/*参考链接：https://wrfranklin.org/Research/Short_Notes/pnpoly.html*/
+	for (i = 0, j = nvert - 1; i < nvert; j = i++)
+	{
+		if (((verty[i] > testy) != (verty[j] > testy)) &&
+			(testx < (vertx[j] - vertx[i]) * (testy - verty[i]) / (verty[j] - verty[i]) + vertx[i]))
+		{
+			c = !c;
+		}
+	}
+	return c;
+}
+
+/**
+  * 函    数：判断指定点是否在指定角度内部
+  * 参    数：X Y 指定点的坐标
+  * 参    数：StartAngle EndAngle 起始角度和终止角度，范围：-180~180
+  *           水平向右为0度，水平向左为180度或-180度，下方为正数，上方为负数，顺时针旋转
+  * 返 回 值：指定点是否在指定角度内部，1：在内部，0：不在内部
+  */
+uint8_t OLED_IsInAngle(int16_t X, int16_t Y, int16_t StartAngle, int16_t EndAngle)
+{
+	int16_t PointAngle;
+	PointAngle = atan2(Y, X) / 3.14 * 180;	//计算指定点的弧度，并转换为角度表示
+	if (StartAngle < EndAngle)	//起始角度小于终止角度的情况
+	{
+		/*如果指定角度在起始终止角度之间，则判定指定点在指定角度*/
+		if (PointAngle >= StartAngle && PointAngle <= EndAngle)
+		{
+			return 1;
+		}
+	}
+	else			//起始角度大于于终止角度的情况
+	{
+		/*如果指定角度大于起始角度或者小于终止角度，则判定指定点在指定角度*/
+		if (PointAngle >= StartAngle || PointAngle <= EndAngle)
+		{
+			return 1;
+		}
+	}
+	return 0;		//不满足以上条件，则判断判定指定点不在指定角度
+}
+
+/**
+  * 函    数：从字符串中提取一个字符（UTF8或GB2312编码）
+  * 参    数：String 指定字符串的当前位置
+  * 参    数：SingleChar 用于存放提取结果的子字符串，至少5字节
+  * 返 回 值：本次消耗的字节数，0表示字符串结束
+  * 说    明：遇到不完整的多字节字符时，返回0结束显示
+  *           遇到非法首字节时，SingleChar置为空字符串，返回1跳过此字节
+  */
+static uint8_t OLED_GetChar(char *String, char *SingleChar)
+{
+	uint8_t i, CharLength;
+	
+	if (String[0] == '\0') {return 0;}
+	
+#ifdef OLED_CHARSET_UTF8						//定义字符集为UTF8
+	if ((String[0] & 0x80) == 0x00)			{CharLength = 1;}	//第一个字节为0xxxxxxx
+	else if ((String[0] & 0xE0) == 0xC0)	{CharLength = 2;}	//第一个字节为110xxxxx
+	else if ((String[0] & 0xF0) == 0xE0)	{CharLength = 3;}	//第一个字节为1110xxxx
+	else if ((String[0] & 0xF8) == 0xF0)	{CharLength = 4;}	//第一个字节为11110xxx
+	else
+	{
+		SingleChar[0] = '\0';				//意外情况，忽略此字节
+		return 1;
+	}
+#endif
+	
+#ifdef OLED_CHARSET_GB2312						//定义字符集为GB2312
+	CharLength = (String[0] & 0x80) ? 2 : 1;	//最高位为1则为双字节字符
+#endif
+	
+	for (i = 0; i < CharLength; i ++)
+	{
+		if (String[i] == '\0') {return 0;}	//意外情况，结束显示
+		SingleChar[i] = String[i];
+	}
+	SingleChar[i] = '\0';
+	
+	return CharLength;
+}
+
+/**
+  * 函    数：在字模库OLED_CF16x16中查找指定汉字
+  * 参    数：SingleChar 指定汉字的子字符串
+  * 返 回 值：字模库中的下标，未找到时为末尾默认图形的下标
+  */
+static uint16_t OLED_FindChinese(char *SingleChar)
+{
+	uint16_t pIndex;
+	
+	/*如果找到最后一个字符（定义为空字符串），则表示字符未在字模库定义，停止寻找*/
+	for (pIndex = 0; strcmp(OLED_CF16x16[pIndex].Index, "") != 0; pIndex ++)
+	{
+		if (strcmp(OLED_CF16x16[pIndex].Index, SingleChar) == 0)
+		{
+			break;
+		}
+	}
+	return pIndex;
+}
+
+/**
+  * 函    数：8x8点阵转置
+  * 参    数：In 输入的8个字节，看作8行点阵，In[0]为第0行，每行的Bit7为第0列
+  * 参    数：Out 输出的8个字节，为In转置后的点阵，Out[r]的Bit(7-c)等于In[c]的Bit(7-r)
+  * 返 回 值：无
+  * 说    明：以两个32位数分三步交换2x2、4x4、8x8子块，无需逐位循环
+  *           参考：Hacker's Delight 7-3 Transposing a Bit Matrix
+  */
+static void OLED_Transpose8x8(const uint8_t *In, uint8_t *Out)
+{
+	uint32_t x, y, t;
+	
+	x = (uint32_t)In[0] << 24 | (uint32_t)In[1] << 16 | (uint32_t)In[2] << 8 | In[3];
+	y = (uint32_t)In[4] << 24 | (uint32_t)In[5] << 16 | (uint32_t)In[6] << 8 | In[7];
+	
+	t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);		//交换2x2子块
+	t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+	
+	t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);	//交换4x4子块
+	t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+	
+	t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);				//交换8x8子块
+	y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+	x = t;
+	
+	Out[0] = x >> 24; Out[1] = x >> 16; Out[2] = x >> 8; Out[3] = x;
+	Out[4] = y >> 24; Out[5] = y >> 16; Out[6] = y >> 8; Out[7] = y;
+}
+
+/**
+  * 函    数：将字模旋转90度
+  * 参    数：In 字模数据，格式与OLED_ShowImage的图像相同
+  * 参    数：Width 字模宽度，范围：1~16
+  * 参    数：Pages 字模页数，范围：1~2
+  * 参    数：Out 旋转后的字模，宽度为Pages*8，高度为Width，格式与OLED_ShowImage的图像相同
+  * 参    数：Up 0：顺时针旋转，文字从上向下阅读；1：逆时针旋转，文字从下向上阅读
+  * 返 回 值：无
+  * 说    明：字模按8x8分块，每块调用一次OLED_Transpose8x8，通过输入列的排列和输出的顺序完成旋转
+  */
+static void OLED_RotateGlyph(const uint8_t *In, uint8_t Width, uint8_t Pages, uint8_t *Out, uint8_t Up)
+{
+	uint8_t Block[8], T[8];
+	uint8_t p, b, c, w, Rows, OutWidth = Pages * 8;
+	
+	for (p = 0; p < Pages; p ++)						//输入的每一页
+	{
+		for (b = 0; b * 8 < Width; b ++)				//页内的每个8列分块
+		{
+			w = Width - b * 8 < 8 ? Width - b * 8 : 8;	//此分块的实际列数
+			
+			/*排列分块的列，不足8列时在前面补0*/
+			/*顺时针：列倒序；逆时针：列正序*/
+			for (c = 0; c < 8; c ++)
+			{
+				if (c < 8 - w)	{Block[c] = 0;}
+				else if (Up)	{Block[c] = In[p * Width + b * 8 + c - (8 - w)];}
+				else			{Block[c] = In[p * Width + b * 8 + 7 - c];}
+			}
+			OLED_Transpose8x8(Block, T);
+			
+			/*顺时针：输入第p页成为输出倒数第p个8列，第b块成为输出第b页*/
+			/*逆时针：输入第p页成为输出第p个8列，第b块成为输出倒数第b页*/
+			Rows = Up ? (Width - 1 - b * 8) / 8 : b;
+			for (c = 0; c < 8; c ++)
+			{
+				if (Up)	{Out[Rows * OutWidth + p * 8 + c] = T[7 - c];}
+				else	{Out[Rows * OutWidth + (Pages - 1 - p) * 8 + c] = T[c];}
+			}
+		}
+	}
+}
+
+/**
+  * 函    数：向显存写入一列像素（覆盖写入，列内未点亮的像素清零）
+  * 参    数：X 指定列的横坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Y 指定列顶端的纵坐标，范围：-32768~32767，屏幕区域：0~63
+  * 参    数：Bits 列像素数据，Bit0在最上方
+  * 参    数：Height 列高度，范围：1~16
+  * 返 回 值：无
+  */
+void OLED_PutColumn(int16_t X, int16_t Y, uint32_t Bits, uint8_t Height)
+{
+	int16_t Page, Shift, j;
+	uint32_t Mask;
+	
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
+	if (!OLED_ClipTest(X, Y, X, Y + Height - 1)) {return;}	//超出裁剪区域的内容不显示
+	
+	/*Bit0对应第Y行，去掉裁剪区域外的行，之后只写入Mask内的像素*/
+	Mask = (1UL << Height) - 1;
+	if (OLED_ClipNeeded)
+	{
+		if (Y < OLED_CY0) {Mask &= ~((1UL << (OLED_CY0 - Y)) - 1);}
+		if (Y + Height - 1 > OLED_CY1) {Mask &= (1UL << (OLED_CY1 - Y + 1)) - 1;}
+	}
+	Bits &= Mask;
+	
+	/*旋转90/270度时，逻辑上的一列是显存中的一行，逐点写入*/
+	if (OLED_TRANSPOSED)
+	{
+		for (j = 0; Mask; j ++, Mask >>= 1, Bits >>= 1)
+		{
+			if (Mask & 0x01)
+			{
+				OLED_DisplayBuf[X / 8][Y + j] = (OLED_DisplayBuf[X / 8][Y + j] & ~(0x01 << (X % 8))) | (Bits & 0x01) << (X % 8);
+			}
+		}
+		return;
+	}
+	
+	/*负数坐标向下取整计算页地址，保证Shift始终为0~7*/
+	Page = Y >= 0 ? Y / 8 : -((7 - Y) / 8);
+	Shift = Y - Page * 8;
+	
+	Mask <<= Shift;
+	Bits <<= Shift;
+	
+	/*一列最多跨越3页，Mask在该页有Bit时该页一定在裁剪区域内*/
+	for (j = 0; Mask; j ++, Mask >>= 8, Bits >>= 8)
+	{
+		if (Mask & 0xFF)
+		{
+			OLED_DisplayBuf[Page + j][X] = (OLED_DisplayBuf[Page + j][X] & ~Mask) | Bits;
+		}
 	}
-	return Result;
 }
 
 /**
-  * 函    数：判断指定点是否在指定多边形内部
-  * 参    数：nvert 多边形的顶点数
-  * 参    数：vertx verty 包含多边形顶点的x和y坐标的数组
-  * 参    数：testx testy 测试点的X和y坐标
-  * 返 回 值：指定点是否在指定多边形内部，1：在内部，0：不在内部
+  * 函    数：查询比例字体中两字符之间的字距调整量
+  * 参    数：Font 指定比例字体
+  * 参    数：Left Right 相邻的两个字符
+  * 返 回 值：字距调整量，无调整时为0
   */
-uint8_t OLED_pnpoly(uint8_t nvert, int16_t *vertx, int16_t *verty, int16_t testx, int16_t testy)
+int8_t OLED_GetKern(const OLED_PFont_t *Font, char Left, char Right)
 {
-	int16_t i, j, c = 0;
+	const OLED_PKern_t *pKern = Font->Kern;
 	
-	/*此算法由W. Randolph Franklin提出*/
-	/*参考链接：https://wrfranklin.org/Research/Short_Notes/pnpoly.html*/
-	for (i = 0, j = nvert - 1; i < nvert; j = i++)
+	if (pKern == 0) {return 0;}
+	for (; pKern->Left != '\0'; pKern ++)
 	{
-		if (((verty[i] > testy) != (verty[j] > testy)) &&
-			(testx < (vertx[j] - vertx[i]) * (testy - verty[i]) / (verty[j] - verty[i]) + vertx[i]))
+		if (pKern->Left == Left && pKern->Right == Right)
 		{
-			c = !c;
+			return pKern->Adjust;
 		}
 	}
-	return c;
+	return 0;
 }
 
 /**
-  * 函    数：判断指定点是否在指定角度内部
-  * 参    数：X Y 指定点的坐标
-  * 参    数：StartAngle EndAngle 起始角度和终止角度，范围：-180~180
-  *           水平向右为0度，水平向左为180度或-180度，下方为正数，上方为负数，顺时针旋转
-  * 返 回 值：指定点是否在指定角度内部，1：在内部，0：不在内部
+  * 函    数：比例字体文本排版（显示与测量共用）
+  * 参    数：X Y 指定字符串左上角的坐标
+  * 参    数：String 指定字符串，范围：ASCII码可见字符或中文字符组成的字符串
+  * 参    数：Font 指定比例字体
+  * 参    数：IsDraw 是否写入显存，0：只测量宽度，1：测量并显示
+  * 返 回 值：字符串的像素宽度（不含末尾字间距）
+  * 说    明：字形与字间距在同一遍历中逐列覆盖写入，无需预先清空区域
   */
-uint8_t OLED_IsInAngle(int16_t X, int16_t Y, int16_t StartAngle, int16_t EndAngle)
+uint16_t OLED_PStringRun(int16_t X, int16_t Y, char *String, const OLED_PFont_t *Font, uint8_t IsDraw)
 {
-	int16_t PointAngle;
-	PointAngle = atan2(Y, X) / 3.14 * 180;	//计算指定点的弧度，并转换为角度表示
-	if (StartAngle < EndAngle)	//起始角度小于终止角度的情况
+	char SingleChar[5];
+	char Prev = '\0';
+	uint8_t CharLength, Width, Page, i;
+	int16_t XOffset = 0, Gap, s;
+	const uint8_t *pData;
+	uint32_t Bits;
+	
+	while ((CharLength = OLED_GetChar(String, SingleChar)) != 0)
 	{
-		/*如果指定角度在起始终止角度之间，则判定指定点在指定角度*/
-		if (PointAngle >= StartAngle && PointAngle <= EndAngle)
+		String += CharLength;
+		if (SingleChar[0] == '\0') {continue;}		//非法字节，忽略
+		
+		if (CharLength == 1)						//单字节字符，使用比例字形
 		{
-			return 1;
+			if (SingleChar[0] < Font->First || SingleChar[0] > Font->Last)
+			{
+				SingleChar[0] = '?';				//字体未覆盖的字符显示'?'
+			}
+			
+			/*字间距与字距调整，第一个字符前不加间距*/
+			Gap = Prev != '\0' ? Font->Spacing + OLED_GetKern(Font, Prev, SingleChar[0]) : 0;
+			Prev = SingleChar[0];
+			
+			Width = Font->Glyph[SingleChar[0] - Font->First].Width;
+			pData = Font->Data + Font->Glyph[SingleChar[0] - Font->First].Offset;
+			Page = Font->Height / 8;
 		}
-	}
-	else			//起始角度大于于终止角度的情况
-	{
-		/*如果指定角度大于起始角度或者小于终止角度，则判定指定点在指定角度*/
-		if (PointAngle >= StartAngle || PointAngle <= EndAngle)
+		else										//多字节字符
 		{
-			return 1;
+			Gap = Prev != '\0' ? Font->Spacing : 0;
+			
+			if (Font->Height >= 16)					//字体足够高，显示16*16汉字
+			{
+				Prev = ' ';							//汉字不参与字距调整
+				Width = 16;
+				pData = OLED_CF16x16[OLED_FindChinese(SingleChar)].Data;
+				Page = 2;
+			}
+			else									//空间不足，显示'?'
+			{
+				Prev = '?';
+				Width = Font->Glyph['?' - Font->First].Width;
+				pData = Font->Data + Font->Glyph['?' - Font->First].Offset;
+				Page = 1;
+			}
+		}
+		
+		if (IsDraw)
+		{
+			/*只清空净间距（字间距加字距调整）所在的列，净间距不大于0时不能擦除前一个字形*/
+			for (s = 0; s < Gap; s ++)
+			{
+				OLED_PutColumn(X + XOffset + s, Y, 0, Font->Height);
+			}
+		}
+		XOffset += Gap;
+		
+		if (IsDraw)
+		{
+			/*逐列覆盖写入字形*/
+			for (i = 0; i < Width; i ++)
+			{
+				Bits = pData[i];
+				if (Page == 2) {Bits |= (uint32_t)pData[Width + i] << 8;}
+				OLED_PutColumn(X + XOffset + i, Y, Bits, Font->Height);
+			}
 		}
+		XOffset += Width;
+		
+		/*右侧已超出屏幕或裁剪区域，后续字符无需绘制*/
+		if (IsDraw && (X + OLED_View.OriginX + XOffset > OLED_SCREEN_WIDTH - 1 || X + OLED_View.OriginX + XOffset > OLED_View.ClipX1)) {break;}
 	}
-	return 0;		//不满足以上条件，则判断判定指定点不在指定角度
+	
+	return XOffset > 0 ? XOffset : 0;
+}
+
+/**
+  * 函    数：记录一次更新的耗时
+  * 参    数：Cycles 本次OLED_Update/OLED_UpdateArea耗费的周期数
+  * 返 回 值：无
+  * 说    明：未定义OLED_STATS时为空宏
+  */
+#ifdef OLED_STATS
+static void OLED_StatsUpdateDone(uint32_t Cycles)
+{
+	OLED_Stats.Updates ++;
+	if (Cycles > OLED_Stats.MaxUpdateCycles) {OLED_Stats.MaxUpdateCycles = Cycles;}
 }
+#else
+#define OLED_StatsUpdateDone(Cycles)
+#endif
 
 /*********************工具函数*/
 
@@ -442,14 +1205,16 @@ uint8_t OLED_IsInAngle(int16_t X, int16_t Y, int16_t StartAngle, int16_t EndAngl
 void OLED_Update(void)
 {
 	uint8_t j;
-	/*遍历每一页*/
-	for (j = 0; j < 8; j ++)
+	OLED_STATS_START();
+	/*遍历当前屏幕的每一页*/
+	for (j = 0; j < OLED_PAGES; j ++)
 	{
 		/*设置光标位置为每一页的第一列*/
 		OLED_SetCursor(j, 0);
-		/*连续写入128个数据，将显存数组的数据写入到OLED硬件*/
-		OLED_WriteData(OLED_DisplayBuf[j], 128);
+		/*连续写入一整行数据，将显存数组的数据写入到OLED硬件*/
+		OLED_WriteData(OLED_DisplayBuf[j], OLED_WIDTH);
 	}
+	OLED_StatsUpdateDone(OLED_STATS_ELAPSED());
 }
 
 /**
@@ -470,6 +1235,10 @@ void OLED_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 {
 	int16_t j;
 	int16_t Page, Page1;
+	OLED_STATS_START();
+	
+	/*旋转90/270度时，逻辑区域转换为显存区域*/
+	if (OLED_TRANSPOSED) {OLED_SWAP(X, Y); OLED_SWAP(Width, Height);}
 	
 	/*负数坐标在计算页地址时需要加一个偏移*/
 	/*(Y + Height - 1) / 8 + 1的目的是(Y + Height) / 8并向上取整*/
@@ -484,7 +1253,7 @@ void OLED_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 	/*遍历指定区域涉及的相关页*/
 	for (j = Page; j < Page1; j ++)
 	{
-		if (X >= 0 && X <= 127 && j >= 0 && j <= 7)		//超出屏幕的内容不显示
+		if (X >= 0 && X <= OLED_WIDTH - 1 && j >= 0 && j <= OLED_PAGES - 1)	//超出屏幕的内容不显示
 		{
 			/*设置光标位置为相关页的指定列*/
 			OLED_SetCursor(j, X);
@@ -492,6 +1261,131 @@ void OLED_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 			OLED_WriteData(&OLED_DisplayBuf[j][X], Width);
 		}
 	}
+	OLED_StatsUpdateDone(OLED_STATS_ELAPSED());
+}
+
+#ifdef OLED_STATS
+
+/**
+  * 函    数：读取OLED传输统计
+  * 参    数：Stats 读出的统计值
+  * 返 回 值：无
+  * 说    明：自上次OLED_ResetStats以来的累计值，统计所有屏幕的传输
+  */
+void OLED_GetStats(OLED_Stats_t *Stats)
+{
+	*Stats = OLED_Stats;
+}
+
+/**
+  * 函    数：清零OLED传输统计
+  * 参    数：无
+  * 返 回 值：无
+  */
+void OLED_ResetStats(void)
+{
+	memset(&OLED_Stats, 0, sizeof(OLED_Stats));
+}
+
+#endif
+
+/**
+  * 函    数：保存当前的裁剪区域和原点
+  * 参    数：无
+  * 返 回 值：1：成功，0：嵌套层数已达OLED_VIEW_DEPTH
+  * 说    明：与OLED_PopView成对使用，之后用OLED_SetOrigin、OLED_SetClip设置控件自己的区域
+  */
+uint8_t OLED_PushView(void)
+{
+	if (OLED_ViewDepth >= OLED_VIEW_DEPTH) {return 0;}
+	OLED_ViewStack[OLED_ViewDepth ++] = OLED_View;
+	return 1;
+}
+
+/**
+  * 函    数：恢复上一次OLED_PushView保存的裁剪区域和原点
+  * 参    数：无
+  * 返 回 值：无
+  */
+void OLED_PopView(void)
+{
+	if (OLED_ViewDepth > 0) {OLED_View = OLED_ViewStack[-- OLED_ViewDepth];}
+}
+
+/**
+  * 函    数：清除所有裁剪区域和原点
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：原点回到(0, 0)，裁剪区域为整个屏幕，保存的状态全部丢弃
+  */
+void OLED_ResetView(void)
+{
+	OLED_View_t None = OLED_VIEW_NONE;
+	OLED_View = None;
+	OLED_ViewDepth = 0;
+}
+
+/**
+  * 函    数：设置绘图原点
+  * 参    数：X 原点的横坐标，相对于上一次OLED_PushView时的原点
+  * 参    数：Y 原点的纵坐标，相对于上一次OLED_PushView时的原点
+  * 返 回 值：无
+  * 说    明：之后所有绘图函数的坐标都相对于此原点，不影响更新函数
+  */
+void OLED_SetOrigin(int16_t X, int16_t Y)
+{
+	OLED_View.OriginX = X;
+	OLED_View.OriginY = Y;
+	if (OLED_ViewDepth > 0)
+	{
+		OLED_View.OriginX += OLED_ViewStack[OLED_ViewDepth - 1].OriginX;
+		OLED_View.OriginY += OLED_ViewStack[OLED_ViewDepth - 1].OriginY;
+	}
+}
+
+/**
+  * 函    数：设置裁剪区域
+  * 参    数：X 指定区域左上角的横坐标，相对于当前原点
+  * 参    数：Y 指定区域左上角的纵坐标，相对于当前原点
+  * 参    数：Width 指定区域的宽度，范围：0~255
+  * 参    数：Height 指定区域的高度，范围：0~255
+  * 返 回 值：无
+  * 说    明：区域会与上一次OLED_PushView时的裁剪区域求交，嵌套的控件不会画到外层区域之外
+  *           之后所有绘图函数只修改此区域内的像素，不影响更新函数
+  */
+void OLED_SetClip(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
+{
+	OLED_View_t Parent = OLED_VIEW_NONE;
+	
+	if (OLED_ViewDepth > 0) {Parent = OLED_ViewStack[OLED_ViewDepth - 1];}
+	
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
+	OLED_View.ClipX0 = X > Parent.ClipX0 ? X : Parent.ClipX0;
+	OLED_View.ClipY0 = Y > Parent.ClipY0 ? Y : Parent.ClipY0;
+	OLED_View.ClipX1 = X + Width - 1 < Parent.ClipX1 ? X + Width - 1 : Parent.ClipX1;
+	OLED_View.ClipY1 = Y + Height - 1 < Parent.ClipY1 ? Y + Height - 1 : Parent.ClipY1;
+}
+
+/**
+  * 函    数：进入一个视口，原点和裁剪区域都设为指定区域
+  * 参    数：X 指定区域左上角的横坐标，相对于当前原点
+  * 参    数：Y 指定区域左上角的纵坐标，相对于当前原点
+  * 参    数：Width 指定区域的宽度，范围：0~255
+  * 参    数：Height 指定区域的高度，范围：0~255
+  * 返 回 值：1：成功，0：嵌套层数已达OLED_VIEW_DEPTH，状态不变
+  * 说    明：相当于OLED_PushView后设置原点与裁剪区域，控件在其中以(0, 0)为左上角绘制
+  *           使用完毕后调用OLED_PopView恢复
+  */
+uint8_t OLED_PushViewport(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
+{
+	int16_t OriginX = OLED_View.OriginX, OriginY = OLED_View.OriginY;
+	
+	if (!OLED_PushView()) {return 0;}
+	OLED_View.OriginX = OriginX + X;
+	OLED_View.OriginY = OriginY + Y;
+	OLED_SetClip(0, 0, Width, Height);
+	return 1;
 }
 
 /**
@@ -503,9 +1397,9 @@ void OLED_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 void OLED_Clear(void)
 {
 	uint8_t i, j;
-	for (j = 0; j < 8; j ++)				//遍历8页
+	for (j = 0; j < OLED_PAGES; j ++)		//遍历每一页
 	{
-		for (i = 0; i < 128; i ++)			//遍历128列
+		for (i = 0; i < OLED_WIDTH; i ++)	//遍历每一列
 		{
 			OLED_DisplayBuf[j][i] = 0x00;	//将显存数组数据全部清零
 		}
@@ -523,18 +1417,12 @@ void OLED_Clear(void)
   */
 void OLED_ClearArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 {
-	int16_t i, j;
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
 	
-	for (j = Y; j < Y + Height; j ++)		//遍历指定页
-	{
-		for (i = X; i < X + Width; i ++)	//遍历指定列
-		{
-			if (i >= 0 && i <= 127 && j >=0 && j <= 63)				//超出屏幕的内容不显示
-			{
-				OLED_DisplayBuf[j / 8][i] &= ~(0x01 << (j % 8));	//将显存数组指定数据清零
-			}
-		}
-	}
+	/*与裁剪区域求交后按页整字节清零*/
+	OLED_ClipUpdate();
+	OLED_FillRect(X, Y, X + Width - 1, Y + Height - 1, OLED_OP_CLEAR);
 }
 
 /**
@@ -546,9 +1434,9 @@ void OLED_ClearArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 void OLED_Reverse(void)
 {
 	uint8_t i, j;
-	for (j = 0; j < 8; j ++)				//遍历8页
+	for (j = 0; j < OLED_PAGES; j ++)		//遍历每一页
 	{
-		for (i = 0; i < 128; i ++)			//遍历128列
+		for (i = 0; i < OLED_WIDTH; i ++)	//遍历每一列
 		{
 			OLED_DisplayBuf[j][i] ^= 0xFF;	//将显存数组数据全部取反
 		}
@@ -566,18 +1454,12 @@ void OLED_Reverse(void)
   */
 void OLED_ReverseArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 {
-	int16_t i, j;
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
 	
-	for (j = Y; j < Y + Height; j ++)		//遍历指定页
-	{
-		for (i = X; i < X + Width; i ++)	//遍历指定列
-		{
-			if (i >= 0 && i <= 127 && j >=0 && j <= 63)			//超出屏幕的内容不显示
-			{
-				OLED_DisplayBuf[j / 8][i] ^= 0x01 << (j % 8);	//将显存数组指定数据取反
-			}
-		}
-	}
+	/*与裁剪区域求交后按页整字节取反*/
+	OLED_ClipUpdate();
+	OLED_FillRect(X, Y, X + Width - 1, Y + Height - 1, OLED_OP_XOR);
 }
 
 /**
@@ -588,11 +1470,39 @@ void OLED_ReverseArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
   * 参    数：FontSize 指定字体大小
   *           范围：OLED_8X16		宽8像素，高16像素
   *                 OLED_6X8		宽6像素，高8像素
+  *           可再或上OLED_VERTICAL或OLED_VERTICAL_UP，将字符旋转90度显示
   * 返 回 值：无
   * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
 void OLED_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize)
 {
+	uint8_t Glyph[16];
+	uint8_t Up = (FontSize & OLED_VERTICAL_MASK) == OLED_VERTICAL_UP;
+	
+	if (FontSize & OLED_VERTICAL_MASK)	//竖排，字模旋转90度后显示
+	{
+		FontSize &= ~OLED_VERTICAL_MASK;
+		
+		/*完全在裁剪区域外时不旋转字模*/
+		X += OLED_View.OriginX;
+		Y += OLED_View.OriginY;
+		if (!OLED_ClipTest(X, Y, X + 15, Y + FontSize - 1)) {return;}
+		X -= OLED_View.OriginX;
+		Y -= OLED_View.OriginY;
+		
+		if (FontSize == OLED_8X16)		//旋转后宽16像素，高8像素
+		{
+			OLED_RotateGlyph(OLED_F8x16[Char - ' '], 8, 2, Glyph, Up);
+			OLED_ShowImage(X, Y, 16, 8, Glyph);
+		}
+		else if (FontSize == OLED_6X8)	//旋转后宽8像素，高6像素
+		{
+			OLED_RotateGlyph(OLED_F6x8[Char - ' '], 6, 1, Glyph, Up);
+			OLED_ShowImage(X, Y, 8, 6, Glyph);
+		}
+		return;
+	}
+	
 	if (FontSize == OLED_8X16)		//字体为宽8像素，高16像素
 	{
 		/*将ASCII字模库OLED_F8x16的指定数据以8*16的图像格式显示*/
@@ -613,7 +1523,11 @@ void OLED_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize)
   * 参    数：FontSize 指定字体大小
   *           范围：OLED_8X16		宽8像素，高16像素
   *                 OLED_6X8		宽6像素，高8像素
+  *           可再或上OLED_VERTICAL（顺时针旋转，从上向下排列）
+  *           或OLED_VERTICAL_UP（逆时针旋转，从下向上排列）竖排显示
   * 返 回 值：无
+  * 说    明：竖排时(X, Y)为第一个字符的左上角，每个字符宽为字体高度，高为字体宽度
+  *           OLED_Printf同样支持竖排，其余显示数字的函数不支持
   * 说    明：显示的中文字符需要在OLED_Data.c里的OLED_CF16x16数组定义
   *           未找到指定中文字符时，会显示默认图形（一个方框，内部一个问号）
   *           当字体大小为OLED_8X16时，中文字符以16*16点阵正常显示
@@ -622,112 +1536,57 @@ void OLED_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize)
   */
 void OLED_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize)
 {
-	uint16_t i = 0;
 	char SingleChar[5];
-	uint8_t CharLength = 0;
+	uint8_t CharLength, Advance;
 	uint16_t XOffset = 0;
-	uint16_t pIndex;
+	uint16_t pIndex = 0;
+	int16_t CharX = X, CharY = Y;
+	uint8_t Vertical = FontSize & OLED_VERTICAL_MASK;
+	uint8_t Glyph[32];
+	
+	FontSize &= ~OLED_VERTICAL_MASK;
 	
-	while (String[i] != '\0')	//遍历字符串
+	/*逐个提取字符（UTF8或GB2312编码），字符串结束或遇到不完整的字符时停止*/
+	while ((CharLength = OLED_GetChar(String, SingleChar)) != 0)
 	{
+		String += CharLength;
+		if (SingleChar[0] == '\0') {continue;}		//非法字节，忽略
 		
-#ifdef OLED_CHARSET_UTF8						//定义字符集为UTF8
-		/*此段代码的目的是，提取UTF8字符串中的一个字符，转存到SingleChar子字符串中*/
-		/*判断UTF8编码第一个字节的标志位*/
-		if ((String[i] & 0x80) == 0x00)			//第一个字节为0xxxxxxx
-		{
-			CharLength = 1;						//字符为1字节
-			SingleChar[0] = String[i ++];		//将第一个字节写入SingleChar第0个位置，随后i指向下一个字节
-			SingleChar[1] = '\0';				//为SingleChar添加字符串结束标志位
-		}
-		else if ((String[i] & 0xE0) == 0xC0)	//第一个字节为110xxxxx
-		{
-			CharLength = 2;						//字符为2字节
-			SingleChar[0] = String[i ++];		//将第一个字节写入SingleChar第0个位置，随后i指向下一个字节
-			if (String[i] == '\0') {break;}		//意外情况，跳出循环，结束显示
-			SingleChar[1] = String[i ++];		//将第二个字节写入SingleChar第1个位置，随后i指向下一个字节
-			SingleChar[2] = '\0';				//为SingleChar添加字符串结束标志位
-		}
-		else if ((String[i] & 0xF0) == 0xE0)	//第一个字节为1110xxxx
-		{
-			CharLength = 3;						//字符为3字节
-			SingleChar[0] = String[i ++];
-			if (String[i] == '\0') {break;}
-			SingleChar[1] = String[i ++];
-			if (String[i] == '\0') {break;}
-			SingleChar[2] = String[i ++];
-			SingleChar[3] = '\0';
-		}
-		else if ((String[i] & 0xF8) == 0xF0)	//第一个字节为11110xxx
-		{
-			CharLength = 4;						//字符为4字节
-			SingleChar[0] = String[i ++];
-			if (String[i] == '\0') {break;}
-			SingleChar[1] = String[i ++];
-			if (String[i] == '\0') {break;}
-			SingleChar[2] = String[i ++];
-			if (String[i] == '\0') {break;}
-			SingleChar[3] = String[i ++];
-			SingleChar[4] = '\0';
-		}
-		else
+		/*此字符沿排列方向占用的像素数，汉字在OLED_8X16下为16，其余为字体宽度*/
+		Advance = FontSize;
+		if (CharLength > 1 && FontSize == OLED_8X16)
 		{
-			i ++;			//意外情况，i指向下一个字节，忽略此字节，继续判断下一个字节
-			continue;
+			pIndex = OLED_FindChinese(SingleChar);
+			Advance = 16;
 		}
-#endif
 		
-#ifdef OLED_CHARSET_GB2312						//定义字符集为GB2312
-		/*此段代码的目的是，提取GB2312字符串中的一个字符，转存到SingleChar子字符串中*/
-		/*判断GB2312字节的最高位标志位*/
-		if ((String[i] & 0x80) == 0x00)			//最高位为0
-		{
-			CharLength = 1;						//字符为1字节
-			SingleChar[0] = String[i ++];		//将第一个字节写入SingleChar第0个位置，随后i指向下一个字节
-			SingleChar[1] = '\0';				//为SingleChar添加字符串结束标志位
-		}
-		else									//最高位为1
-		{
-			CharLength = 2;						//字符为2字节
-			SingleChar[0] = String[i ++];		//将第一个字节写入SingleChar第0个位置，随后i指向下一个字节
-			if (String[i] == '\0') {break;}		//意外情况，跳出循环，结束显示
-			SingleChar[1] = String[i ++];		//将第二个字节写入SingleChar第1个位置，随后i指向下一个字节
-			SingleChar[2] = '\0';				//为SingleChar添加字符串结束标志位
-		}
-#endif
+		/*计算此字符左上角的位置，竖排时沿Y轴向下或向上排列*/
+		/*向上排列时，每个字符的底边紧贴前一个字符的顶边，字符高度不同也不会重叠*/
+		if (Vertical == OLED_VERTICAL)			{CharY = Y + XOffset;}
+		else if (Vertical == OLED_VERTICAL_UP)	{CharY = XOffset ? CharY - Advance : Y;}
+		else									{CharX = X + XOffset;}
+		XOffset += Advance;
 		
-		/*显示上述代码提取到的SingleChar*/
-		if (CharLength == 1)	//如果是单字节字符
+		if (CharLength == 1)					//单字节字符
 		{
-			/*使用OLED_ShowChar显示此字符*/
-			OLED_ShowChar(X + XOffset, Y, SingleChar[0], FontSize);
-			XOffset += FontSize;
+			OLED_ShowChar(CharX, CharY, SingleChar[0], FontSize | Vertical);
 		}
-		else					//否则，即多字节字符
+		else if (FontSize == OLED_8X16)			//多字节字符，以16*16点阵显示，竖排时先旋转
 		{
-			/*遍历整个字模库，从字模库中寻找此字符的数据*/
-			/*如果找到最后一个字符（定义为空字符串），则表示字符未在字模库定义，停止寻找*/
-			for (pIndex = 0; strcmp(OLED_CF16x16[pIndex].Index, "") != 0; pIndex ++)
-			{
-				/*找到匹配的字符*/
-				if (strcmp(OLED_CF16x16[pIndex].Index, SingleChar) == 0)
-				{
-					break;		//跳出循环，此时pIndex的值为指定字符的索引
-				}
-			}
-			if (FontSize == OLED_8X16)		//给定字体为8*16点阵
+			if (Vertical)
 			{
-				/*将字模库OLED_CF16x16的指定数据以16*16的图像格式显示*/
-				OLED_ShowImage(X + XOffset, Y, 16, 16, OLED_CF16x16[pIndex].Data);
-				XOffset += 16;
+				OLED_RotateGlyph(OLED_CF16x16[pIndex].Data, 16, 2, Glyph, Vertical == OLED_VERTICAL_UP);
+				OLED_ShowImage(CharX, CharY, 16, 16, Glyph);
 			}
-			else if (FontSize == OLED_6X8)	//给定字体为6*8点阵
+			else
 			{
-				/*空间不足，此位置显示'?'*/
-				OLED_ShowChar(X + XOffset, Y, '?', OLED_6X8);
-				XOffset += OLED_6X8;
+				OLED_ShowImage(CharX, CharY, 16, 16, OLED_CF16x16[pIndex].Data);
 			}
 		}
+		else									//OLED_6X8空间不足，此位置显示'?'
+		{
+			OLED_ShowChar(CharX, CharY, '?', OLED_6X8 | Vertical);
+		}
 	}
 }
 
@@ -907,42 +1766,66 @@ void OLED_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, u
   */
 void OLED_ShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image)
 {
-	uint8_t i = 0, j = 0;
-	int16_t Page, Shift;
+	int16_t i, j, i0, i1, Row, Page, Shift;
+	uint8_t Data, Mask;
+	
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
 	
 	/*将图像所在区域清空*/
-	OLED_ClearArea(X, Y, Width, Height);
+	OLED_ClipUpdate();
+	OLED_FillRect(X, Y, X + Width - 1, Y + Height - 1, OLED_OP_CLEAR);
 	
-	/*遍历指定图像涉及的相关页*/
+	/*图像按整页写入，最后一页可能超出Height，外接矩形按整页计算*/
 	/*(Height - 1) / 8 + 1的目的是Height / 8并向上取整*/
+	if (Width == 0 || Height == 0) {return;}
+	if (!OLED_ClipTest(X, Y, X + Width - 1, Y + ((Height - 1) / 8 + 1) * 8 - 1)) {return;}
+	
+	/*只遍历裁剪区域内的列*/
+	i0 = OLED_CX0 > X ? OLED_CX0 - X : 0;
+	i1 = OLED_CX1 < X + Width - 1 ? OLED_CX1 - X : Width - 1;
+	
+	/*遍历指定图像涉及的相关页*/
 	for (j = 0; j < (Height - 1) / 8 + 1; j ++)
 	{
-		/*遍历指定图像涉及的相关列*/
-		for (i = 0; i < Width; i ++)
+		/*此页数据最上方像素所在的行，去掉裁剪区域外的行*/
+		Row = Y + j * 8;
+		Mask = 0xFF;
+		if (OLED_ClipNeeded)
+		{
+			if (Row < OLED_CY0) {Mask = OLED_CY0 - Row >= 8 ? 0 : 0xFF << (OLED_CY0 - Row);}
+			if (Row + 7 > OLED_CY1) {Mask &= Row + 7 - OLED_CY1 >= 8 ? 0 : 0xFF >> (Row + 7 - OLED_CY1);}
+			if (Mask == 0) {continue;}
+		}
+		
+		/*旋转90/270度时，图像的一列是显存中的一行，逐点写入*/
+		if (OLED_TRANSPOSED)
 		{
-			if (X + i >= 0 && X + i <= 127)		//超出屏幕的内容不显示
+			for (i = i0; i <= i1; i ++)
 			{
-				/*负数坐标在计算页地址和移位时需要加一个偏移*/
-				Page = Y / 8;
-				Shift = Y % 8;
-				if (Y < 0)
-				{
-					Page -= 1;
-					Shift += 8;
-				}
-				
-				if (Page + j >= 0 && Page + j <= 7)		//超出屏幕的内容不显示
+				Data = Image[j * Width + i] & Mask;
+				for (Shift = 0; Data; Shift ++, Data >>= 1)
 				{
-					/*显示图像在当前页的内容*/
-					OLED_DisplayBuf[Page + j][X + i] |= Image[j * Width + i] << (Shift);
-				}
-				
-				if (Page + j + 1 >= 0 && Page + j + 1 <= 7)		//超出屏幕的内容不显示
-				{					
-					/*显示图像在下一页的内容*/
-					OLED_DisplayBuf[Page + j + 1][X + i] |= Image[j * Width + i] >> (8 - Shift);
+					if (Data & 0x01) {OLED_DisplayBuf[(X + i) / 8][Row + Shift] |= 0x01 << ((X + i) % 8);}
 				}
 			}
+			continue;
+		}
+		
+		/*负数坐标向下取整计算页地址，保证Shift始终为0~7*/
+		Page = Row >= 0 ? Row / 8 : -((7 - Row) / 8);
+		Shift = Row - Page * 8;
+		
+		/*遍历指定图像涉及的相关列，数据在某页有Bit时该页一定在裁剪区域内*/
+		for (i = i0; i <= i1; i ++)
+		{
+			Data = Image[j * Width + i] & Mask;
+			
+			/*显示图像在当前页的内容*/
+			if ((uint8_t)(Data << Shift)) {OLED_DisplayBuf[Page][X + i] |= Data << Shift;}
+			
+			/*显示图像在下一页的内容*/
+			if (Shift && (Data >> (8 - Shift))) {OLED_DisplayBuf[Page + 1][X + i] |= Data >> (8 - Shift);}
 		}
 	}
 }
@@ -973,6 +1856,37 @@ void OLED_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...)
 	OLED_ShowString(X, Y, String, FontSize);//OLED显示字符数组（字符串）
 }
 
+/**
+  * 函    数：OLED使用比例字体显示字符串（支持ASCII码和中文混合写入）
+  * 参    数：X 指定字符串左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Y 指定字符串左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
+  * 参    数：String 指定要显示的字符串，范围：ASCII码可见字符或中文字符组成的字符串
+  * 参    数：Font 指定比例字体
+  *           范围：&OLED_PF8x16	高16像素，宽度可变
+  *                 &OLED_PF6x8		高8像素，宽度可变
+  * 返 回 值：已显示部分的像素宽度
+  * 说    明：每个字符按自身字形宽度前进，并应用字体的字距调整表
+  *           中文字符在16像素高的字体下以16*16点阵显示，否则显示'?'
+  * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+uint16_t OLED_ShowPString(int16_t X, int16_t Y, char *String, const OLED_PFont_t *Font)
+{
+	return OLED_PStringRun(X, Y, String, Font, 1);
+}
+
+/**
+  * 函    数：测量字符串使用比例字体显示时的像素宽度
+  * 参    数：String 指定要测量的字符串
+  * 参    数：Font 指定比例字体
+  * 返 回 值：字符串的像素宽度，与OLED_ShowPString实际显示的宽度一致
+  * 说    明：可用于右对齐或居中显示，例如居中：
+  *           OLED_ShowPString((128 - OLED_MeasureString(Str, &OLED_PF6x8)) / 2, Y, Str, &OLED_PF6x8);
+  */
+uint16_t OLED_MeasureString(char *String, const OLED_PFont_t *Font)
+{
+	return OLED_PStringRun(0, 0, String, Font, 0);
+}
+
 /**
   * 函    数：OLED在指定位置画一个点
   * 参    数：X 指定点的横坐标，范围：-32768~32767，屏幕区域：0~127
@@ -982,10 +1896,12 @@ void OLED_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...)
   */
 void OLED_DrawPoint(int16_t X, int16_t Y)
 {
-	if (X >= 0 && X <= 127 && Y >=0 && Y <= 63)		//超出屏幕的内容不显示
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
+	if (OLED_ClipTest(X, Y, X, Y))		//超出裁剪区域的内容不显示
 	{
 		/*将显存数组指定位置的一个Bit数据置1*/
-		OLED_DisplayBuf[Y / 8][X] |= 0x01 << (Y % 8);
+		OLED_Plot(X, Y);
 	}
 }
 
@@ -997,8 +1913,12 @@ void OLED_DrawPoint(int16_t X, int16_t Y)
   */
 uint8_t OLED_GetPoint(int16_t X, int16_t Y)
 {
-	if (X >= 0 && X <= 127 && Y >=0 && Y <= 63)		//超出屏幕的内容不读取
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
+	if (X >= 0 && X <= OLED_SCREEN_WIDTH - 1 && Y >= 0 && Y <= OLED_SCREEN_HEIGHT - 1)	//超出屏幕的内容不读取
 	{
+		if (OLED_TRANSPOSED) {OLED_SWAP(X, Y);}		//逻辑坐标转换为显存坐标
+		
 		/*判断指定位置的数据*/
 		if (OLED_DisplayBuf[Y / 8][X] & 0x01 << (Y % 8))
 		{
@@ -1024,27 +1944,26 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1)
 	int16_t x0 = X0, y0 = Y0, x1 = X1, y1 = Y1;
 	uint8_t yflag = 0, xyflag = 0;
 	
+	/*加上原点，外接矩形完全在裁剪区域外时直接返回*/
+	x0 += OLED_View.OriginX; x1 += OLED_View.OriginX;
+	y0 += OLED_View.OriginY; y1 += OLED_View.OriginY;
+	if (!OLED_ClipTest(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 > x1 ? x0 : x1, y0 > y1 ? y0 : y1)) {return;}
+	
 	if (y0 == y1)		//横线单独处理
 	{
 		/*0号点X坐标大于1号点X坐标，则交换两点X坐标*/
 		if (x0 > x1) {temp = x0; x0 = x1; x1 = temp;}
 		
-		/*遍历X坐标*/
-		for (x = x0; x <= x1; x ++)
-		{
-			OLED_DrawPoint(x, y0);	//依次画点
-		}
+		/*与裁剪区域求交后整字节写入*/
+		OLED_FillRect(x0, y0, x1, y0, OLED_OP_SET);
 	}
 	else if (x0 == x1)	//竖线单独处理
 	{
 		/*0号点Y坐标大于1号点Y坐标，则交换两点Y坐标*/
 		if (y0 > y1) {temp = y0; y0 = y1; y1 = temp;}
 		
-		/*遍历Y坐标*/
-		for (y = y0; y <= y1; y ++)
-		{
-			OLED_DrawPoint(x0, y);	//依次画点
-		}
+		/*与裁剪区域求交后按页整字节写入*/
+		OLED_FillRect(x0, y0, x0, y1, OLED_OP_SET);
 	}
 	else				//斜线
 	{
@@ -1093,10 +2012,10 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1)
 		y = y0;
 		
 		/*画起始点，同时判断标志位，将坐标换回来*/
-		if (yflag && xyflag){OLED_DrawPoint(y, -x);}
-		else if (yflag)		{OLED_DrawPoint(x, -y);}
-		else if (xyflag)	{OLED_DrawPoint(y, x);}
-		else				{OLED_DrawPoint(x, y);}
+		if (yflag && xyflag){OLED_Plot(y, -x);}
+		else if (yflag)		{OLED_Plot(x, -y);}
+		else if (xyflag)	{OLED_Plot(y, x);}
+		else				{OLED_Plot(x, y);}
 		
 		while (x < x1)		//遍历X轴的每个点
 		{
@@ -1112,10 +2031,10 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1)
 			}
 			
 			/*画每一个点，同时判断标志位，将坐标换回来*/
-			if (yflag && xyflag){OLED_DrawPoint(y, -x);}
-			else if (yflag)		{OLED_DrawPoint(x, -y);}
-			else if (xyflag)	{OLED_DrawPoint(y, x);}
-			else				{OLED_DrawPoint(x, y);}
+			if (yflag && xyflag){OLED_Plot(y, -x);}
+			else if (yflag)		{OLED_Plot(x, -y);}
+			else if (xyflag)	{OLED_Plot(y, x);}
+			else				{OLED_Plot(x, y);}
 		}	
 	}
 }
@@ -1134,34 +2053,23 @@ void OLED_DrawLine(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1)
   */
 void OLED_DrawRectangle(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uint8_t IsFilled)
 {
-	int16_t i, j;
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
+	OLED_ClipUpdate();
+	
 	if (!IsFilled)		//指定矩形不填充
 	{
-		/*遍历上下X坐标，画矩形上下两条线*/
-		for (i = X; i < X + Width; i ++)
-		{
-			OLED_DrawPoint(i, Y);
-			OLED_DrawPoint(i, Y + Height - 1);
-		}
-		/*遍历左右Y坐标，画矩形左右两条线*/
-		for (i = Y; i < Y + Height; i ++)
-		{
-			OLED_DrawPoint(X, i);
-			OLED_DrawPoint(X + Width - 1, i);
-		}
+		/*画矩形上下两条线*/
+		OLED_FillRect(X, Y, X + Width - 1, Y, OLED_OP_SET);
+		OLED_FillRect(X, Y + Height - 1, X + Width - 1, Y + Height - 1, OLED_OP_SET);
+		/*画矩形左右两条线*/
+		OLED_FillRect(X, Y, X, Y + Height - 1, OLED_OP_SET);
+		OLED_FillRect(X + Width - 1, Y, X + Width - 1, Y + Height - 1, OLED_OP_SET);
 	}
 	else				//指定矩形填充
 	{
-		/*遍历X坐标*/
-		for (i = X; i < X + Width; i ++)
-		{
-			/*遍历Y坐标*/
-			for (j = Y; j < Y + Height; j ++)
-			{
-				/*在指定区域画点，填充满矩形*/
-				OLED_DrawPoint(i, j);
-			}
-		}
+		/*与裁剪区域求交后按页整字节写入，填充满矩形*/
+		OLED_FillRect(X, Y, X + Width - 1, Y + Height - 1, OLED_OP_SET);
 	}
 }
 
@@ -1181,10 +2089,9 @@ void OLED_DrawRectangle(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, uin
   */
 void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint8_t IsFilled)
 {
-	int16_t minx = X0, miny = Y0, maxx = X0, maxy = Y0;
+	int16_t minx, miny, maxx, maxy;
 	int16_t i, j;
-	int16_t vx[] = {X0, X1, X2};
-	int16_t vy[] = {Y0, Y1, Y2};
+	int16_t vx[3], vy[3];
 	
 	if (!IsFilled)			//指定三角形不填充
 	{
@@ -1195,6 +2102,14 @@ void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X
 	}
 	else					//指定三角形填充
 	{
+		/*加上原点*/
+		X0 += OLED_View.OriginX; X1 += OLED_View.OriginX; X2 += OLED_View.OriginX;
+		Y0 += OLED_View.OriginY; Y1 += OLED_View.OriginY; Y2 += OLED_View.OriginY;
+		vx[0] = X0; vx[1] = X1; vx[2] = X2;
+		vy[0] = Y0; vy[1] = Y1; vy[2] = Y2;
+		minx = maxx = X0;
+		miny = maxy = Y0;
+		
 		/*找到三个点最小的X、Y坐标*/
 		if (X1 < minx) {minx = X1;}
 		if (X2 < minx) {minx = X2;}
@@ -1208,6 +2123,14 @@ void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X
 		if (Y2 > maxy) {maxy = Y2;}
 		
 		/*最小最大坐标之间的矩形为可能需要填充的区域*/
+		/*此区域与裁剪区域求交，只遍历交集中的点，之后画点无需判断边界*/
+		if (!OLED_ClipTest(minx, miny, maxx, maxy)) {return;}
+		if (minx < OLED_CX0) {minx = OLED_CX0;}
+		if (miny < OLED_CY0) {miny = OLED_CY0;}
+		if (maxx > OLED_CX1) {maxx = OLED_CX1;}
+		if (maxy > OLED_CY1) {maxy = OLED_CY1;}
+		OLED_ClipNeeded = 0;
+		
 		/*遍历此区域中所有的点*/
 		/*遍历X坐标*/		
 		for (i = minx; i <= maxx; i ++)
@@ -1217,7 +2140,7 @@ void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X
 			{
 				/*调用OLED_pnpoly，判断指定点是否在指定三角形之中*/
 				/*如果在，则画点，如果不在，则不做处理*/
-				if (OLED_pnpoly(3, vx, vy, i, j)) {OLED_DrawPoint(i, j);}
+				if (OLED_pnpoly(3, vx, vy, i, j)) {OLED_Plot(i, j);}
 			}
 		}
 	}
@@ -1236,7 +2159,12 @@ void OLED_DrawTriangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X
   */
 void OLED_DrawCircle(int16_t X, int16_t Y, uint8_t Radius, uint8_t IsFilled)
 {
-	int16_t x, y, d, j;
+	int16_t x, y, d;
+	
+	/*加上原点，外接矩形完全在裁剪区域外时直接返回，完全在区域内时画点无需判断边界*/
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
+	if (!OLED_ClipTest(X - Radius, Y - Radius, X + Radius, Y + Radius)) {return;}
 	
 	/*使用Bresenham算法画圆，可以避免耗时的浮点运算，效率更高*/
 	/*参考文档：https://www.cs.montana.edu/courses/spring2009/425/dslectures/Bresenham.pdf*/
@@ -1247,19 +2175,15 @@ void OLED_DrawCircle(int16_t X, int16_t Y, uint8_t Radius, uint8_t IsFilled)
 	y = Radius;
 	
 	/*画每个八分之一圆弧的起始点*/
-	OLED_DrawPoint(X + x, Y + y);
-	OLED_DrawPoint(X - x, Y - y);
-	OLED_DrawPoint(X + y, Y + x);
-	OLED_DrawPoint(X - y, Y - x);
+	OLED_Plot(X + x, Y + y);
+	OLED_Plot(X - x, Y - y);
+	OLED_Plot(X + y, Y + x);
+	OLED_Plot(X - y, Y - x);
 	
 	if (IsFilled)		//指定圆填充
 	{
-		/*遍历起始点Y坐标*/
-		for (j = -y; j < y; j ++)
-		{
-			/*在指定区域画点，填充部分圆*/
-			OLED_DrawPoint(X, Y + j);
-		}
+		/*填充起始点所在的列*/
+		OLED_FillRect(X, Y - y, X, Y + y - 1, OLED_OP_SET);
 	}
 	
 	while (x < y)		//遍历X轴的每个点
@@ -1276,32 +2200,24 @@ void OLED_DrawCircle(int16_t X, int16_t Y, uint8_t Radius, uint8_t IsFilled)
 		}
 		
 		/*画每个八分之一圆弧的点*/
-		OLED_DrawPoint(X + x, Y + y);
-		OLED_DrawPoint(X + y, Y + x);
-		OLED_DrawPoint(X - x, Y - y);
-		OLED_DrawPoint(X - y, Y - x);
-		OLED_DrawPoint(X + x, Y - y);
-		OLED_DrawPoint(X + y, Y - x);
-		OLED_DrawPoint(X - x, Y + y);
-		OLED_DrawPoint(X - y, Y + x);
+		OLED_Plot(X + x, Y + y);
+		OLED_Plot(X + y, Y + x);
+		OLED_Plot(X - x, Y - y);
+		OLED_Plot(X - y, Y - x);
+		OLED_Plot(X + x, Y - y);
+		OLED_Plot(X + y, Y - x);
+		OLED_Plot(X - x, Y + y);
+		OLED_Plot(X - y, Y + x);
 		
 		if (IsFilled)	//指定圆填充
 		{
-			/*遍历中间部分*/
-			for (j = -y; j < y; j ++)
-			{
-				/*在指定区域画点，填充部分圆*/
-				OLED_DrawPoint(X + x, Y + j);
-				OLED_DrawPoint(X - x, Y + j);
-			}
+			/*填充中间部分的两列*/
+			OLED_FillRect(X + x, Y - y, X + x, Y + y - 1, OLED_OP_SET);
+			OLED_FillRect(X - x, Y - y, X - x, Y + y - 1, OLED_OP_SET);
 			
-			/*遍历两侧部分*/
-			for (j = -x; j < x; j ++)
-			{
-				/*在指定区域画点，填充部分圆*/
-				OLED_DrawPoint(X - y, Y + j);
-				OLED_DrawPoint(X + y, Y + j);
-			}
+			/*填充两侧部分的两列*/
+			OLED_FillRect(X - y, Y - x, X - y, Y + x - 1, OLED_OP_SET);
+			OLED_FillRect(X + y, Y - x, X + y, Y + x - 1, OLED_OP_SET);
 		}
 	}
 }
@@ -1320,10 +2236,15 @@ void OLED_DrawCircle(int16_t X, int16_t Y, uint8_t Radius, uint8_t IsFilled)
   */
 void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFilled)
 {
-	int16_t x, y, j;
+	int16_t x, y;
 	int16_t a = A, b = B;
 	float d1, d2;
 	
+	/*加上原点，外接矩形完全在裁剪区域外时直接返回，完全在区域内时画点无需判断边界*/
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
+	if (!OLED_ClipTest(X - A, Y - B, X + A, Y + B)) {return;}
+	
 	/*使用Bresenham算法画椭圆，可以避免部分耗时的浮点运算，效率更高*/
 	/*参考链接：https://blog.csdn.net/myf_666/article/details/128167392*/
 	
@@ -1333,20 +2254,15 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
 	
 	if (IsFilled)	//指定椭圆填充
 	{
-		/*遍历起始点Y坐标*/
-		for (j = -y; j < y; j ++)
-		{
-			/*在指定区域画点，填充部分椭圆*/
-			OLED_DrawPoint(X, Y + j);
-			OLED_DrawPoint(X, Y + j);
-		}
+		/*填充起始点所在的列*/
+		OLED_FillRect(X, Y - y, X, Y + y - 1, OLED_OP_SET);
 	}
 	
 	/*画椭圆弧的起始点*/
-	OLED_DrawPoint(X + x, Y + y);
-	OLED_DrawPoint(X - x, Y - y);
-	OLED_DrawPoint(X - x, Y + y);
-	OLED_DrawPoint(X + x, Y - y);
+	OLED_Plot(X + x, Y + y);
+	OLED_Plot(X - x, Y - y);
+	OLED_Plot(X - x, Y + y);
+	OLED_Plot(X + x, Y - y);
 	
 	/*画椭圆中间部分*/
 	while (b * b * (x + 1) < a * a * (y - 0.5))
@@ -1364,20 +2280,16 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
 		
 		if (IsFilled)	//指定椭圆填充
 		{
-			/*遍历中间部分*/
-			for (j = -y; j < y; j ++)
-			{
-				/*在指定区域画点，填充部分椭圆*/
-				OLED_DrawPoint(X + x, Y + j);
-				OLED_DrawPoint(X - x, Y + j);
-			}
+			/*填充中间部分的两列*/
+			OLED_FillRect(X + x, Y - y, X + x, Y + y - 1, OLED_OP_SET);
+			OLED_FillRect(X - x, Y - y, X - x, Y + y - 1, OLED_OP_SET);
 		}
 		
 		/*画椭圆中间部分圆弧*/
-		OLED_DrawPoint(X + x, Y + y);
-		OLED_DrawPoint(X - x, Y - y);
-		OLED_DrawPoint(X - x, Y + y);
-		OLED_DrawPoint(X + x, Y - y);
+		OLED_Plot(X + x, Y + y);
+		OLED_Plot(X - x, Y - y);
+		OLED_Plot(X - x, Y + y);
+		OLED_Plot(X + x, Y - y);
 	}
 	
 	/*画椭圆两侧部分*/
@@ -1399,20 +2311,16 @@ void OLED_DrawEllipse(int16_t X, int16_t Y, uint8_t A, uint8_t B, uint8_t IsFill
 		
 		if (IsFilled)	//指定椭圆填充
 		{
-			/*遍历两侧部分*/
-			for (j = -y; j < y; j ++)
-			{
-				/*在指定区域画点，填充部分椭圆*/
-				OLED_DrawPoint(X + x, Y + j);
-				OLED_DrawPoint(X - x, Y + j);
-			}
+			/*填充两侧部分的两列*/
+			OLED_FillRect(X + x, Y - y, X + x, Y + y - 1, OLED_OP_SET);
+			OLED_FillRect(X - x, Y - y, X - x, Y + y - 1, OLED_OP_SET);
 		}
 		
 		/*画椭圆两侧部分圆弧*/
-		OLED_DrawPoint(X + x, Y + y);
-		OLED_DrawPoint(X - x, Y - y);
-		OLED_DrawPoint(X - x, Y + y);
-		OLED_DrawPoint(X + x, Y - y);
+		OLED_Plot(X + x, Y + y);
+		OLED_Plot(X - x, Y - y);
+		OLED_Plot(X - x, Y + y);
+		OLED_Plot(X + x, Y - y);
 	}
 }
 
@@ -1437,15 +2345,20 @@ void OLED_DrawArc(int16_t X, int16_t Y, uint8_t Radius, int16_t StartAngle, int1
 	
 	/*此函数借用Bresenham算法画圆的方法*/
 	
+	/*加上原点，外接矩形完全在裁剪区域外时直接返回，完全在区域内时画点无需判断边界*/
+	X += OLED_View.OriginX;
+	Y += OLED_View.OriginY;
+	if (!OLED_ClipTest(X - Radius, Y - Radius, X + Radius, Y + Radius)) {return;}
+	
 	d = 1 - Radius;
 	x = 0;
 	y = Radius;
 	
 	/*在画圆的每个点时，判断指定点是否在指定角度内，在，则画点，不在，则不做处理*/
-	if (OLED_IsInAngle(x, y, StartAngle, EndAngle))	{OLED_DrawPoint(X + x, Y + y);}
-	if (OLED_IsInAngle(-x, -y, StartAngle, EndAngle)) {OLED_DrawPoint(X - x, Y - y);}
-	if (OLED_IsInAngle(y, x, StartAngle, EndAngle)) {OLED_DrawPoint(X + y, Y + x);}
-	if (OLED_IsInAngle(-y, -x, StartAngle, EndAngle)) {OLED_DrawPoint(X - y, Y - x);}
+	if (OLED_IsInAngle(x, y, StartAngle, EndAngle))	{OLED_Plot(X + x, Y + y);}
+	if (OLED_IsInAngle(-x, -y, StartAngle, EndAngle)) {OLED_Plot(X - x, Y - y);}
+	if (OLED_IsInAngle(y, x, StartAngle, EndAngle)) {OLED_Plot(X + y, Y + x);}
+	if (OLED_IsInAngle(-y, -x, StartAngle, EndAngle)) {OLED_Plot(X - y, Y - x);}
 	
 	if (IsFilled)	//指定圆弧填充
 	{
@@ -1453,7 +2366,7 @@ void OLED_DrawArc(int16_t X, int16_t Y, uint8_t Radius, int16_t StartAngle, int1
 		for (j = -y; j < y; j ++)
 		{
 			/*在填充圆的每个点时，判断指定点是否在指定角度内，在，则画点，不在，则不做处理*/
-			if (OLED_IsInAngle(0, j, StartAngle, EndAngle)) {OLED_DrawPoint(X, Y + j);}
+			if (OLED_IsInAngle(0, j, StartAngle, EndAngle)) {OLED_Plot(X, Y + j);}
 		}
 	}
 	
@@ -1471,14 +2384,14 @@ void OLED_DrawArc(int16_t X, int16_t Y, uint8_t Radius, int16_t StartAngle, int1
 		}
 		
 		/*在画圆的每个点时，判断指定点是否在指定角度内，在，则画点，不在，则不做处理*/
-		if (OLED_IsInAngle(x, y, StartAngle, EndAngle)) {OLED_DrawPoint(X + x, Y + y);}
-		if (OLED_IsInAngle(y, x, StartAngle, EndAngle)) {OLED_DrawPoint(X + y, Y + x);}
-		if (OLED_IsInAngle(-x, -y, StartAngle, EndAngle)) {OLED_DrawPoint(X - x, Y - y);}
-		if (OLED_IsInAngle(-y, -x, StartAngle, EndAngle)) {OLED_DrawPoint(X - y, Y - x);}
-		if (OLED_IsInAngle(x, -y, StartAngle, EndAngle)) {OLED_DrawPoint(X + x, Y - y);}
-		if (OLED_IsInAngle(y, -x, StartAngle, EndAngle)) {OLED_DrawPoint(X + y, Y - x);}
-		if (OLED_IsInAngle(-x, y, StartAngle, EndAngle)) {OLED_DrawPoint(X - x, Y + y);}
-		if (OLED_IsInAngle(-y, x, StartAngle, EndAngle)) {OLED_DrawPoint(X - y, Y + x);}
+		if (OLED_IsInAngle(x, y, StartAngle, EndAngle)) {OLED_Plot(X + x, Y + y);}
+		if (OLED_IsInAngle(y, x, StartAngle, EndAngle)) {OLED_Plot(X + y, Y + x);}
+		if (OLED_IsInAngle(-x, -y, StartAngle, EndAngle)) {OLED_Plot(X - x, Y - y);}
+		if (OLED_IsInAngle(-y, -x, StartAngle, EndAngle)) {OLED_Plot(X - y, Y - x);}
+		if (OLED_IsInAngle(x, -y, StartAngle, EndAngle)) {OLED_Plot(X + x, Y - y);}
+		if (OLED_IsInAngle(y, -x, StartAngle, EndAngle)) {OLED_Plot(X + y, Y - x);}
+		if (OLED_IsInAngle(-x, y, StartAngle, EndAngle)) {OLED_Plot(X - x, Y + y);}
+		if (OLED_IsInAngle(-y, x, StartAngle, EndAngle)) {OLED_Plot(X - y, Y + x);}
 		
 		if (IsFilled)	//指定圆弧填充
 		{
@@ -1486,16 +2399,16 @@ void OLED_DrawArc(int16_t X, int16_t Y, uint8_t Radius, int16_t StartAngle, int1
 			for (j = -y; j < y; j ++)
 			{
 				/*在填充圆的每个点时，判断指定点是否在指定角度内，在，则画点，不在，则不做处理*/
-				if (OLED_IsInAngle(x, j, StartAngle, EndAngle)) {OLED_DrawPoint(X + x, Y + j);}
-				if (OLED_IsInAngle(-x, j, StartAngle, EndAngle)) {OLED_DrawPoint(X - x, Y + j);}
+				if (OLED_IsInAngle(x, j, StartAngle, EndAngle)) {OLED_Plot(X + x, Y + j);}
+				if (OLED_IsInAngle(-x, j, StartAngle, EndAngle)) {OLED_Plot(X - x, Y + j);}
 			}
 			
 			/*遍历两侧部分*/
 			for (j = -x; j < x; j ++)
 			{
 				/*在填充圆的每个点时，判断指定点是否在指定角度内，在，则画点，不在，则不做处理*/
-				if (OLED_IsInAngle(-y, j, StartAngle, EndAngle)) {OLED_DrawPoint(X - y, Y + j);}
-				if (OLED_IsInAngle(y, j, StartAngle, EndAngle)) {OLED_DrawPoint(X + y, Y + j);}
+				if (OLED_IsInAngle(-y, j, StartAngle, EndAngle)) {OLED_Plot(X - y, Y + j);}
+				if (OLED_IsInAngle(y, j, StartAngle, EndAngle)) {OLED_Plot(X + y, Y + j);}
 			}
 		}
 	}
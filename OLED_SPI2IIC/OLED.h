@@ -11,22 +11,153 @@
 #define OLED_8X16				8
 #define OLED_6X8				6
 
+/*竖排标志，与FontSize按位或，用于OLED_ShowChar、OLED_ShowString、OLED_Printf*/
+#define OLED_VERTICAL			0x80	//字符顺时针旋转90度，从上向下排列
+#define OLED_VERTICAL_UP		0xC0	//字符逆时针旋转90度，从下向上排列
+#define OLED_VERTICAL_MASK		0xC0
+
+/*屏幕尺寸配置*/
+/*以下均为编译期常量，显存大小、边界判断和初始化命令都由其决定，裁剪判断可被编译器常量折叠*/
+/*0.96寸128x64屏幕使用默认值；0.91寸128x32屏幕将OLED_HEIGHT改为32，显存与刷新数据量减半*/
+#ifndef OLED_WIDTH
+#define OLED_WIDTH				128
+#endif
+#ifndef OLED_HEIGHT
+#define OLED_HEIGHT				64
+#endif
+#define OLED_PAGES				(OLED_HEIGHT / 8)
+
+/*1.3寸屏幕的驱动芯片SH1106有132列，显示区域从第2列开始，使用此类屏幕时需要定义此宏*/
+//#define OLED_SH1106
+#ifdef OLED_SH1106
+#define OLED_COL_OFFSET			2
+#else
+#define OLED_COL_OFFSET			0
+#endif
+
+/*Orientation参数取值，见OLED_SetOrientation*/
+/*Bit0：左右翻转（0xA0），Bit1：上下翻转（0xC0），Bit2：行列互换（软件绘制时交换X、Y）*/
+#define OLED_ROTATE_0			0x00	//正常方向
+#define OLED_MIRROR_X			0x01	//左右镜像
+#define OLED_MIRROR_Y			0x02	//上下镜像
+#define OLED_ROTATE_180			0x03	//旋转180度
+#define OLED_ROTATE_90			0x05	//顺时针旋转90度，逻辑屏幕为OLED_HEIGHT x OLED_WIDTH
+#define OLED_ROTATE_270			0x06	//顺时针旋转270度，逻辑屏幕为OLED_HEIGHT x OLED_WIDTH
+#define OLED_TRANSPOSE			0x04
+
+/*当前屏幕的逻辑宽度和高度，旋转90/270度时宽高互换*/
+#define OLED_SCREEN_WIDTH		(OLED_Current->Orientation & OLED_TRANSPOSE ? OLED_HEIGHT : OLED_WIDTH)
+#define OLED_SCREEN_HEIGHT		(OLED_Current->Orientation & OLED_TRANSPOSE ? OLED_WIDTH : OLED_HEIGHT)
+
+/*裁剪区域与原点可嵌套保存的层数，见OLED_PushView*/
+#ifndef OLED_VIEW_DEPTH
+#define OLED_VIEW_DEPTH			4
+#endif
+
 /*IsFilled参数数值*/
 #define OLED_UNFILLED			0
 #define OLED_FILLED				1
 
+/*通信方式配置*/
+/*定义此宏时，使用寄存器直接操作、逐位展开的快速软件I2C（SCL：PB8，SDA：PB9），延时校准需要同时编译MyDWT.c*/
+/*注释此宏时，使用通过OLED_W_SCL/OLED_W_SDA写引脚的通用软件I2C，便于移植到其他引脚*/
+#define OLED_I2C_FAST
+
+/*快速软件I2C的目标SCL频率，单位Hz，不应超过屏幕允许的最大值（SSD1306为400kHz）*/
+#ifndef OLED_I2C_CLOCK_HZ
+#define OLED_I2C_CLOCK_HZ		400000
+#endif
+
+/*定义此宏时，OLED不再使用自带的软件I2C，而是通过MyI2C模块的事务队列访问总线*/
+/*用于OLED与传感器共用一条I2C总线，或使用硬件I2C（MYI2C_HARDWARE）*/
+//#define OLED_I2C_BUS
+
+/*定义此宏时，统计传输层的事务数、命令/数据字节数、DWT周期数与单次更新的最长耗时*/
+/*注释此宏时，统计代码与统计变量全部不参与编译，没有任何开销*/
+//#define OLED_STATS
+
 /*********************参数宏定义*/
 
 
+/*类型定义*********************/
+
+/*OLED传输函数，向Address发送控制字节Control与Count个数据*/
+typedef void (*OLED_Write_t)(uint8_t Address, uint8_t Control, const uint8_t *Data, uint8_t Count);
+
+/*OLED屏幕实例，多块屏幕共用一条总线时，每块屏幕一个实例，尺寸均为OLED_WIDTH x OLED_HEIGHT*/
+/*所有成员都由OLED_PanelInit写入，调用者只需提供存储空间，无需预先清零*/
+typedef struct OLED_Panel
+{
+	uint8_t (*Buf)[OLED_WIDTH];			//显存数组，OLED_PAGES页 x OLED_WIDTH列
+	uint8_t Address;					//I2C从机地址（8位写地址），0x78或0x7A
+	uint8_t Orientation;				//屏幕方向，OLED_ROTATE_0等，由OLED_SetOrientation设置
+	OLED_Write_t Write;					//传输函数
+	uint8_t DirtyMin[OLED_PAGES];		//每页的脏列区间，供刷新调度使用
+	uint8_t DirtyMax[OLED_PAGES];		//Min > Max 表示该页无变化
+	struct OLED_Panel *Next;			//已初始化屏幕的链表
+} OLED_Panel_t;
+
+/*OLED传输统计，由OLED_GetStats读出*/
+typedef struct
+{
+	uint32_t Transactions;				//I2C事务数，每次写命令或写数据为一次事务
+	uint32_t CommandBytes;				//命令字节数
+	uint32_t DataBytes;					//数据字节数
+	uint32_t Cycles;					//传输耗费的DWT周期数（主机仿真时为0）
+	uint32_t Updates;					//OLED_Update/OLED_UpdateArea调用次数
+	uint32_t MaxUpdateCycles;			//单次OLED_Update/OLED_UpdateArea的最长周期数
+} OLED_Stats_t;
+
+/*********************类型定义*/
+
+
+/*全局变量声明*********************/
+
+/*OLED显存数组，指向当前屏幕的显存，定义在OLED.c*/
+extern uint8_t (*OLED_DisplayBuf)[OLED_WIDTH];
+
+/*默认屏幕、当前屏幕与屏幕链表，定义在OLED.c*/
+extern OLED_Panel_t OLED_DefaultPanel;
+extern OLED_Panel_t *OLED_Current;
+extern OLED_Panel_t *OLED_PanelList;
+
+/*********************全局变量声明*/
+
+
 /*函数声明*********************/
 
 /*初始化函数*/
 void OLED_Init(void);
 
+/*多屏幕函数*/
+void OLED_PanelInit(OLED_Panel_t *Panel, uint8_t (*Buf)[OLED_WIDTH], uint8_t Address, uint8_t Orientation, OLED_Write_t Write);
+OLED_Panel_t *OLED_Select(OLED_Panel_t *Panel);
+
+/*屏幕方向函数*/
+void OLED_SetOrientation(uint8_t Orientation);
+
+/*底层函数，供动画等扩展模块直接发送显存片段*/
+void OLED_SetCursor(uint8_t Page, uint8_t X);
+void OLED_WriteData(uint8_t *Data, uint8_t Count);
+
 /*更新函数*/
 void OLED_Update(void);
 void OLED_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
 
+/*传输统计函数，定义OLED_STATS时可用*/
+#ifdef OLED_STATS
+void OLED_GetStats(OLED_Stats_t *Stats);
+void OLED_ResetStats(void);
+#endif
+
+/*裁剪与原点函数，只影响绘图函数，不影响更新函数*/
+uint8_t OLED_PushView(void);
+void OLED_PopView(void);
+void OLED_ResetView(void);
+void OLED_SetOrigin(int16_t X, int16_t Y);
+void OLED_SetClip(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+uint8_t OLED_PushViewport(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+
 /*显存控制函数*/
 void OLED_Clear(void);
 void OLED_ClearArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
@@ -44,6 +175,10 @@ void OLED_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, u
 void OLED_ShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image);
 void OLED_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...);
 
+/*比例字体显示函数*/
+uint16_t OLED_ShowPString(int16_t X, int16_t Y, char *String, const OLED_PFont_t *Font);
+uint16_t OLED_MeasureString(char *String, const OLED_PFont_t *Font);
+
 /*绘图函数*/
 void OLED_DrawPoint(int16_t X, int16_t Y);
 uint8_t OLED_GetPoint(int16_t X, int16_t Y);
@@ -0,0 +1,168 @@
+/**
+ ******************************************************************************
+ * @file    OLED_Anim.c
+ * @brief   OLED 差分帧动画播放模块
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 本文件实现关键帧 + 差分帧格式的动画播放器（格式见 OLED_Anim.h）：
+ * - 关键帧一次性写入显存并整屏刷新；
+ * - 之后每一帧只把变化的字节片段写入 OLED_DisplayBuf，
+ *   并通过 OLED_SetCursor + OLED_WriteData 只发送这些片段；
+ * - 帧节拍由定时器中断中调用的 OLED_Anim_Tick() 提供，
+ *   实际的显存修改与总线发送在主循环的 OLED_Anim_Process() 中完成，
+ *   避免在中断里占用 I2C 总线。
+ *
+ * 使用示例：
+ * @code
+ * OLED_Anim_Start(&BootAnim, OLED_ANIM_ONCE);
+ * while (OLED_Anim_IsPlaying())
+ * {
+ *     OLED_Anim_Process();
+ * }
+ * @endcode
+ *
+ * 依赖：
+ * - OLED.h
+ * - OLED_Anim.h
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include "OLED.h"
+#include "OLED_Anim.h"
+
+/* 播放器状态 */
+static const OLED_Anim_t *OLED_Anim_Current = 0;    /**< 当前播放的动画，NULL 表示空闲 */
+static const uint8_t *OLED_Anim_Pos;                /**< 差分帧流读取位置 */
+static uint16_t OLED_Anim_Index;                    /**< 下一帧序号 */
+static uint8_t OLED_Anim_Mode;                      /**< 播放模式 */
+
+/* 由定时器中断修改的节拍变量 */
+static volatile uint16_t OLED_Anim_Countdown;       /**< 距下一帧的剩余节拍 */
+static volatile uint8_t OLED_Anim_Pending;          /**< 下一帧已到期 */
+
+/**
+ * @brief  从关键帧开始重新播放当前动画
+ * @note   关键帧为 NULL 时只回绕差分帧流，不改动显存。
+ */
+static void OLED_Anim_Rewind(void){
+	const OLED_Anim_t *Anim = OLED_Anim_Current;
+
+	if(Anim->KeyFrame){
+		memcpy(OLED_DisplayBuf, Anim->KeyFrame, OLED_PAGES * OLED_WIDTH);
+		OLED_Update();
+	}
+	OLED_Anim_Pos = Anim->Delta;
+	OLED_Anim_Index = 0;
+}
+
+/**
+ * @brief  应用一帧差分数据并发送变化片段
+ * @param  p 本帧在差分帧流中的起始位置
+ * @retval 下一帧的起始位置
+ */
+static const uint8_t *OLED_Anim_ApplyDelta(const uint8_t *p){
+	uint8_t RunCount = *p++;
+	uint8_t Page, Column, Length;
+
+	while(RunCount--){
+		Page = *p++;
+		Column = *p++;
+		Length = *p++;
+
+		// 格式错误的片段直接跳过，避免越界写显存
+		if(Page < OLED_PAGES && Length && (uint16_t)Column + Length <= OLED_WIDTH){
+			memcpy(&OLED_DisplayBuf[Page][Column], p, Length);
+			OLED_SetCursor(Page, Column);
+			OLED_WriteData(&OLED_DisplayBuf[Page][Column], Length);
+		}
+		p += Length;
+	}
+	return p;
+}
+
+/**
+ * @brief  开始播放动画
+ * @param  Anim 动画容器
+ * @param  Mode 播放模式：OLED_ANIM_ONCE / OLED_ANIM_LOOP
+ * @note   关键帧（若有）会在本函数中立即写入显存并整屏刷新，
+ *         第一帧差分在 FrameTime 个节拍后播放。
+ */
+void OLED_Anim_Start(const OLED_Anim_t *Anim, uint8_t Mode){
+	OLED_Anim_Current = 0;      // 先停止节拍，防止中断读到半配置的状态
+	OLED_Anim_Pending = 0;
+
+	if(Anim == 0){
+		return;
+	}
+
+	OLED_Anim_Mode = Mode;
+	OLED_Anim_Current = Anim;
+	OLED_Anim_Rewind();
+
+	OLED_Anim_Countdown = Anim->FrameTime;
+}
+
+/**
+ * @brief  停止播放，显存保持当前画面
+ */
+void OLED_Anim_Stop(void){
+	OLED_Anim_Current = 0;
+	OLED_Anim_Pending = 0;
+}
+
+/**
+ * @brief  查询是否正在播放
+ * @retval 1：正在播放
+ * @retval 0：空闲
+ */
+uint8_t OLED_Anim_IsPlaying(void){
+	return OLED_Anim_Current != 0;
+}
+
+/**
+ * @brief  动画节拍
+ * @note   在定时器中断中周期调用（例如 1ms），只做计数，不访问总线。
+ */
+void OLED_Anim_Tick(void){
+	if(OLED_Anim_Current == 0){
+		return;
+	}
+
+	if(OLED_Anim_Countdown > 1){
+		OLED_Anim_Countdown--;
+	}else{
+		OLED_Anim_Countdown = OLED_Anim_Current->FrameTime;
+		OLED_Anim_Pending = 1;
+	}
+}
+
+/**
+ * @brief  动画处理
+ * @note   在主循环中调用；帧未到期时立即返回。
+ *         若主循环来不及处理，多个到期节拍会合并为一帧，不会累积。
+ */
+void OLED_Anim_Process(void){
+	const OLED_Anim_t *Anim = OLED_Anim_Current;
+
+	if(Anim == 0 || OLED_Anim_Pending == 0){
+		return;
+	}
+	OLED_Anim_Pending = 0;
+
+	if(OLED_Anim_Index >= Anim->FrameCount){
+		// 仅循环模式会走到这里：最后一帧之后回到关键帧
+		OLED_Anim_Rewind();
+		return;
+	}
+
+	OLED_Anim_Pos = OLED_Anim_ApplyDelta(OLED_Anim_Pos);
+	OLED_Anim_Index++;
+
+	if(OLED_Anim_Index >= Anim->FrameCount && OLED_Anim_Mode == OLED_ANIM_ONCE){
+		OLED_Anim_Stop();
+	}
+}
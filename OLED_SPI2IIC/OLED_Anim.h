@@ -0,0 +1,60 @@
+/**
+ ******************************************************************************
+ * @file    OLED_Anim.h
+ * @brief   OLED 差分帧动画播放模块头文件
+ * @note    声明动画容器格式与播放器接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 动画容器 = 一个关键帧 + 若干差分帧：
+ * - 关键帧：完整的 OLED_PAGES 页 x OLED_WIDTH 列显存数据（128x64 时为 1024 字节），
+ *   为 NULL 时表示直接以当前显存内容作为起始画面；
+ * - 差分帧流：按帧顺序紧密排列，每帧格式如下：
+ *
+ *       RunCount                         本帧变化片段数量（0 表示画面不变）
+ *       Page, Column, Length, Data[...]  重复 RunCount 次
+ *
+ *   每个片段表示第 Page 页从 Column 列开始的 Length 个新字节，
+ *   片段不可跨页，Column + Length 不得超过 OLED_WIDTH。
+ *
+ * 播放时仅把变化片段写入 OLED_DisplayBuf 并发送到屏幕，
+ * Flash 占用与总线流量只与画面变化量相关，而与分辨率无关。
+ ******************************************************************************
+ */
+
+#ifndef __OLED_ANIM_H
+#define __OLED_ANIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 播放模式 -----------------------------------------------------------------*/
+#define OLED_ANIM_ONCE      0   ///< 播放一次，停在最后一帧
+#define OLED_ANIM_LOOP      1   ///< 循环播放，结束后从关键帧重新开始
+
+/* 动画容器 -----------------------------------------------------------------*/
+typedef struct
+{
+	const uint8_t *KeyFrame;    ///< 关键帧（OLED_PAGES x OLED_WIDTH 字节），NULL 表示沿用当前显存
+	const uint8_t *Delta;       ///< 差分帧流
+	uint16_t FrameCount;        ///< 差分帧数量（不含关键帧）
+	uint16_t FrameTime;         ///< 帧间隔，单位为 OLED_Anim_Tick() 的调用周期（通常 1ms）
+} OLED_Anim_t;
+
+/* 函数声明 -----------------------------------------------------------------*/
+void OLED_Anim_Start(const OLED_Anim_t *Anim, uint8_t Mode);
+void OLED_Anim_Stop(void);
+uint8_t OLED_Anim_IsPlaying(void);
+void OLED_Anim_Tick(void);
+void OLED_Anim_Process(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __OLED_ANIM_H */
@@ -326,6 +326,529 @@ const uint8_t OLED_F6x8[][6] =
 /*********************ASCII字模数据*/
 
 
+/*比例字体数据*********************/
+
+/*高8像素，宽度可变，字形数据*/
+const uint8_t OLED_PF6x8_Data[] =
+{
+	0x00,0x00,0x00,		//   0
+	0x2F,		// ! 1
+	0x07,0x00,0x07,		// " 2
+	0x14,0x7F,0x14,0x7F,0x14,		// # 3
+	0x24,0x2A,0x7F,0x2A,0x12,		// $ 4
+	0x23,0x13,0x08,0x64,0x62,		// % 5
+	0x36,0x49,0x55,0x22,0x50,		// & 6
+	0x07,		// ' 7
+	0x1C,0x22,0x41,		// ( 8
+	0x41,0x22,0x1C,		// ) 9
+	0x14,0x08,0x3E,0x08,0x14,		// * 10
+	0x08,0x08,0x3E,0x08,0x08,		// + 11
+	0xA0,0x60,		// , 12
+	0x08,0x08,0x08,0x08,0x08,		// - 13
+	0x60,0x60,		// . 14
+	0x20,0x10,0x08,0x04,0x02,		// / 15
+	0x3E,0x51,0x49,0x45,0x3E,		// 0 16
+	0x42,0x7F,0x40,		// 1 17
+	0x42,0x61,0x51,0x49,0x46,		// 2 18
+	0x21,0x41,0x45,0x4B,0x31,		// 3 19
+	0x18,0x14,0x12,0x7F,0x10,		// 4 20
+	0x27,0x45,0x45,0x45,0x39,		// 5 21
+	0x3C,0x4A,0x49,0x49,0x30,		// 6 22
+	0x01,0x71,0x09,0x05,0x03,		// 7 23
+	0x36,0x49,0x49,0x49,0x36,		// 8 24
+	0x06,0x49,0x49,0x29,0x1E,		// 9 25
+	0x36,0x36,		// : 26
+	0x56,0x36,		// ; 27
+	0x08,0x14,0x22,0x41,		// < 28
+	0x14,0x14,0x14,0x14,0x14,		// = 29
+	0x41,0x22,0x14,0x08,		// > 30
+	0x02,0x01,0x51,0x09,0x06,		// ? 31
+	0x3E,0x49,0x55,0x59,0x2E,		// @ 32
+	0x7C,0x12,0x11,0x12,0x7C,		// A 33
+	0x7F,0x49,0x49,0x49,0x36,		// B 34
+	0x3E,0x41,0x41,0x41,0x22,		// C 35
+	0x7F,0x41,0x41,0x22,0x1C,		// D 36
+	0x7F,0x49,0x49,0x49,0x41,		// E 37
+	0x7F,0x09,0x09,0x09,0x01,		// F 38
+	0x3E,0x41,0x49,0x49,0x7A,		// G 39
+	0x7F,0x08,0x08,0x08,0x7F,		// H 40
+	0x41,0x7F,0x41,		// I 41
+	0x20,0x40,0x41,0x3F,0x01,		// J 42
+	0x7F,0x08,0x14,0x22,0x41,		// K 43
+	0x7F,0x40,0x40,0x40,0x40,		// L 44
+	0x7F,0x02,0x0C,0x02,0x7F,		// M 45
+	0x7F,0x04,0x08,0x10,0x7F,		// N 46
+	0x3E,0x41,0x41,0x41,0x3E,		// O 47
+	0x7F,0x09,0x09,0x09,0x06,		// P 48
+	0x3E,0x41,0x51,0x21,0x5E,		// Q 49
+	0x7F,0x09,0x19,0x29,0x46,		// R 50
+	0x46,0x49,0x49,0x49,0x31,		// S 51
+	0x01,0x01,0x7F,0x01,0x01,		// T 52
+	0x3F,0x40,0x40,0x40,0x3F,		// U 53
+	0x1F,0x20,0x40,0x20,0x1F,		// V 54
+	0x3F,0x40,0x38,0x40,0x3F,		// W 55
+	0x63,0x14,0x08,0x14,0x63,		// X 56
+	0x07,0x08,0x70,0x08,0x07,		// Y 57
+	0x61,0x51,0x49,0x45,0x43,		// Z 58
+	0x7F,0x41,0x41,		// [ 59
+	0x02,0x04,0x08,0x10,0x20,		// \ 60
+	0x41,0x41,0x7F,		// ] 61
+	0x04,0x02,0x01,0x02,0x04,		// ^ 62
+	0x40,0x40,0x40,0x40,0x40,		// _ 63
+	0x01,0x02,0x04,		// ` 64
+	0x20,0x54,0x54,0x54,0x78,		// a 65
+	0x7F,0x48,0x44,0x44,0x38,		// b 66
+	0x38,0x44,0x44,0x44,0x20,		// c 67
+	0x38,0x44,0x44,0x48,0x7F,		// d 68
+	0x38,0x54,0x54,0x54,0x18,		// e 69
+	0x08,0x7E,0x09,0x01,0x02,		// f 70
+	0x18,0xA4,0xA4,0xA4,0x7C,		// g 71
+	0x7F,0x08,0x04,0x04,0x78,		// h 72
+	0x44,0x7D,0x40,		// i 73
+	0x40,0x80,0x84,0x7D,		// j 74
+	0x7F,0x10,0x28,0x44,		// k 75
+	0x41,0x7F,0x40,		// l 76
+	0x7C,0x04,0x18,0x04,0x78,		// m 77
+	0x7C,0x08,0x04,0x04,0x78,		// n 78
+	0x38,0x44,0x44,0x44,0x38,		// o 79
+	0xFC,0x24,0x24,0x24,0x18,		// p 80
+	0x18,0x24,0x24,0x18,0xFC,		// q 81
+	0x7C,0x08,0x04,0x04,0x08,		// r 82
+	0x48,0x54,0x54,0x54,0x20,		// s 83
+	0x04,0x3F,0x44,0x40,0x20,		// t 84
+	0x3C,0x40,0x40,0x20,0x7C,		// u 85
+	0x1C,0x20,0x40,0x20,0x1C,		// v 86
+	0x3C,0x40,0x30,0x40,0x3C,		// w 87
+	0x44,0x28,0x10,0x28,0x44,		// x 88
+	0x1C,0xA0,0xA0,0xA0,0x7C,		// y 89
+	0x44,0x64,0x54,0x4C,0x44,		// z 90
+	0x08,0x7F,0x41,		// { 91
+	0x7F,		// | 92
+	0x41,0x7F,0x08,		// } 93
+	0x08,0x04,0x08,0x10,0x08,		// ~ 94
+};
+
+/*高8像素，宽度可变，字形表（数据偏移，字形宽度）*/
+const OLED_PGlyph_t OLED_PF6x8_Glyph[] =
+{
+	{   0, 3},		//   0
+	{   3, 1},		// ! 1
+	{   4, 3},		// " 2
+	{   7, 5},		// # 3
+	{  12, 5},		// $ 4
+	{  17, 5},		// % 5
+	{  22, 5},		// & 6
+	{  27, 1},		// ' 7
+	{  28, 3},		// ( 8
+	{  31, 3},		// ) 9
+	{  34, 5},		// * 10
+	{  39, 5},		// + 11
+	{  44, 2},		// , 12
+	{  46, 5},		// - 13
+	{  51, 2},		// . 14
+	{  53, 5},		// / 15
+	{  58, 5},		// 0 16
+	{  63, 3},		// 1 17
+	{  66, 5},		// 2 18
+	{  71, 5},		// 3 19
+	{  76, 5},		// 4 20
+	{  81, 5},		// 5 21
+	{  86, 5},		// 6 22
+	{  91, 5},		// 7 23
+	{  96, 5},		// 8 24
+	{ 101, 5},		// 9 25
+	{ 106, 2},		// : 26
+	{ 108, 2},		// ; 27
+	{ 110, 4},		// < 28
+	{ 114, 5},		// = 29
+	{ 119, 4},		// > 30
+	{ 123, 5},		// ? 31
+	{ 128, 5},		// @ 32
+	{ 133, 5},		// A 33
+	{ 138, 5},		// B 34
+	{ 143, 5},		// C 35
+	{ 148, 5},		// D 36
+	{ 153, 5},		// E 37
+	{ 158, 5},		// F 38
+	{ 163, 5},		// G 39
+	{ 168, 5},		// H 40
+	{ 173, 3},		// I 41
+	{ 176, 5},		// J 42
+	{ 181, 5},		// K 43
+	{ 186, 5},		// L 44
+	{ 191, 5},		// M 45
+	{ 196, 5},		// N 46
+	{ 201, 5},		// O 47
+	{ 206, 5},		// P 48
+	{ 211, 5},		// Q 49
+	{ 216, 5},		// R 50
+	{ 221, 5},		// S 51
+	{ 226, 5},		// T 52
+	{ 231, 5},		// U 53
+	{ 236, 5},		// V 54
+	{ 241, 5},		// W 55
+	{ 246, 5},		// X 56
+	{ 251, 5},		// Y 57
+	{ 256, 5},		// Z 58
+	{ 261, 3},		// [ 59
+	{ 264, 5},		// \ 60
+	{ 269, 3},		// ] 61
+	{ 272, 5},		// ^ 62
+	{ 277, 5},		// _ 63
+	{ 282, 3},		// ` 64
+	{ 285, 5},		// a 65
+	{ 290, 5},		// b 66
+	{ 295, 5},		// c 67
+	{ 300, 5},		// d 68
+	{ 305, 5},		// e 69
+	{ 310, 5},		// f 70
+	{ 315, 5},		// g 71
+	{ 320, 5},		// h 72
+	{ 325, 3},		// i 73
+	{ 328, 4},		// j 74
+	{ 332, 4},		// k 75
+	{ 336, 3},		// l 76
+	{ 339, 5},		// m 77
+	{ 344, 5},		// n 78
+	{ 349, 5},		// o 79
+	{ 354, 5},		// p 80
+	{ 359, 5},		// q 81
+	{ 364, 5},		// r 82
+	{ 369, 5},		// s 83
+	{ 374, 5},		// t 84
+	{ 379, 5},		// u 85
+	{ 384, 5},		// v 86
+	{ 389, 5},		// w 87
+	{ 394, 5},		// x 88
+	{ 399, 5},		// y 89
+	{ 404, 5},		// z 90
+	{ 409, 3},		// { 91
+	{ 412, 1},		// | 92
+	{ 413, 3},		// } 93
+	{ 416, 5},		// ~ 94
+};
+
+/*高8像素，宽度可变，字距调整表，以{0}结尾*/
+const OLED_PKern_t OLED_PF6x8_Kern[] =
+{
+	{'T', 'a', -1}, {'T', 'c', -1}, {'T', 'e', -1}, {'T', 'o', -1}, {'T', '.', -1}, {'T', ',', -1},
+	{'Y', 'a', -1}, {'Y', '.', -1}, {'Y', ',', -1},
+	{0},
+};
+
+/*高8像素比例字体，字间距1像素*/
+const OLED_PFont_t OLED_PF6x8 = {8, 1, ' ', '~', OLED_PF6x8_Glyph, OLED_PF6x8_Data, OLED_PF6x8_Kern};
+
+/*高16像素，宽度可变，字形数据*/
+const uint8_t OLED_PF8x16_Data[] =
+{
+	0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,		//   0
+	0xF8,0x00,
+	0x33,0x30,		// ! 1
+	0x16,0x0E,0x00,0x16,0x0E,
+	0x00,0x00,0x00,0x00,0x00,		// " 2
+	0x40,0xC0,0x78,0x40,0xC0,0x78,0x40,
+	0x04,0x3F,0x04,0x04,0x3F,0x04,0x04,		// # 3
+	0x70,0x88,0xFC,0x08,0x30,
+	0x18,0x20,0xFF,0x21,0x1E,		// $ 4
+	0xF0,0x08,0xF0,0x00,0xE0,0x18,0x00,
+	0x00,0x21,0x1C,0x03,0x1E,0x21,0x1E,		// % 5
+	0x00,0xF0,0x08,0x88,0x70,0x00,0x00,0x00,
+	0x1E,0x21,0x23,0x24,0x19,0x27,0x21,0x10,		// & 6
+	0x16,0x0E,
+	0x00,0x00,		// ' 7
+	0xE0,0x18,0x04,0x02,
+	0x07,0x18,0x20,0x40,		// ( 8
+	0x02,0x04,0x18,0xE0,
+	0x40,0x20,0x18,0x07,		// ) 9
+	0x40,0x40,0x80,0xF0,0x80,0x40,0x40,
+	0x02,0x02,0x01,0x0F,0x01,0x02,0x02,		// * 10
+	0x00,0x00,0x00,0xF0,0x00,0x00,0x00,
+	0x01,0x01,0x01,0x1F,0x01,0x01,0x01,		// + 11
+	0x00,0x00,
+	0xB0,0x70,		// , 12
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,		// - 13
+	0x00,0x00,
+	0x30,0x30,		// . 14
+	0x00,0x00,0x00,0x80,0x60,0x18,0x04,
+	0x60,0x18,0x06,0x01,0x00,0x00,0x00,		// / 15
+	0xE0,0x10,0x08,0x08,0x10,0xE0,
+	0x0F,0x10,0x20,0x20,0x10,0x0F,		// 0 16
+	0x10,0x10,0xF8,0x00,0x00,
+	0x20,0x20,0x3F,0x20,0x20,		// 1 17
+	0x70,0x08,0x08,0x08,0x88,0x70,
+	0x30,0x28,0x24,0x22,0x21,0x30,		// 2 18
+	0x30,0x08,0x88,0x88,0x48,0x30,
+	0x18,0x20,0x20,0x20,0x11,0x0E,		// 3 19
+	0x00,0xC0,0x20,0x10,0xF8,0x00,
+	0x07,0x04,0x24,0x24,0x3F,0x24,		// 4 20
+	0xF8,0x08,0x88,0x88,0x08,0x08,
+	0x19,0x21,0x20,0x20,0x11,0x0E,		// 5 21
+	0xE0,0x10,0x88,0x88,0x18,0x00,
+	0x0F,0x11,0x20,0x20,0x11,0x0E,		// 6 22
+	0x38,0x08,0x08,0xC8,0x38,0x08,
+	0x00,0x00,0x3F,0x00,0x00,0x00,		// 7 23
+	0x70,0x88,0x08,0x08,0x88,0x70,
+	0x1C,0x22,0x21,0x21,0x22,0x1C,		// 8 24
+	0xE0,0x10,0x08,0x08,0x10,0xE0,
+	0x00,0x31,0x22,0x22,0x11,0x0F,		// 9 25
+	0xC0,0xC0,
+	0x30,0x30,		// : 26
+	0x00,0xC0,0xC0,
+	0x80,0xB0,0x70,		// ; 27
+	0x00,0x80,0x40,0x20,0x10,0x08,
+	0x01,0x02,0x04,0x08,0x10,0x20,		// < 28
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x04,0x04,0x04,0x04,0x04,0x04,0x04,		// = 29
+	0x08,0x10,0x20,0x40,0x80,0x00,
+	0x20,0x10,0x08,0x04,0x02,0x01,		// > 30
+	0x70,0x48,0x08,0x08,0x08,0xF0,
+	0x00,0x00,0x30,0x36,0x01,0x00,		// ? 31
+	0xC0,0x30,0xC8,0x28,0xE8,0x10,0xE0,
+	0x07,0x18,0x27,0x24,0x23,0x14,0x0B,		// @ 32
+	0x00,0x00,0xC0,0x38,0xE0,0x00,0x00,0x00,
+	0x20,0x3C,0x23,0x02,0x02,0x27,0x38,0x20,		// A 33
+	0x08,0xF8,0x88,0x88,0x88,0x70,0x00,
+	0x20,0x3F,0x20,0x20,0x20,0x11,0x0E,		// B 34
+	0xC0,0x30,0x08,0x08,0x08,0x08,0x38,
+	0x07,0x18,0x20,0x20,0x20,0x10,0x08,		// C 35
+	0x08,0xF8,0x08,0x08,0x08,0x10,0xE0,
+	0x20,0x3F,0x20,0x20,0x20,0x10,0x0F,		// D 36
+	0x08,0xF8,0x88,0x88,0xE8,0x08,0x10,
+	0x20,0x3F,0x20,0x20,0x23,0x20,0x18,		// E 37
+	0x08,0xF8,0x88,0x88,0xE8,0x08,0x10,
+	0x20,0x3F,0x20,0x00,0x03,0x00,0x00,		// F 38
+	0xC0,0x30,0x08,0x08,0x08,0x38,0x00,
+	0x07,0x18,0x20,0x20,0x22,0x1E,0x02,		// G 39
+	0x08,0xF8,0x08,0x00,0x00,0x08,0xF8,0x08,
+	0x20,0x3F,0x21,0x01,0x01,0x21,0x3F,0x20,		// H 40
+	0x08,0x08,0xF8,0x08,0x08,
+	0x20,0x20,0x3F,0x20,0x20,		// I 41
+	0x00,0x00,0x08,0x08,0xF8,0x08,0x08,
+	0xC0,0x80,0x80,0x80,0x7F,0x00,0x00,		// J 42
+	0x08,0xF8,0x88,0xC0,0x28,0x18,0x08,
+	0x20,0x3F,0x20,0x01,0x26,0x38,0x20,		// K 43
+	0x08,0xF8,0x08,0x00,0x00,0x00,0x00,
+	0x20,0x3F,0x20,0x20,0x20,0x20,0x30,		// L 44
+	0x08,0xF8,0xF8,0x00,0xF8,0xF8,0x08,
+	0x20,0x3F,0x00,0x3F,0x00,0x3F,0x20,		// M 45
+	0x08,0xF8,0x30,0xC0,0x00,0x08,0xF8,0x08,
+	0x20,0x3F,0x20,0x00,0x07,0x18,0x3F,0x00,		// N 46
+	0xE0,0x10,0x08,0x08,0x08,0x10,0xE0,
+	0x0F,0x10,0x20,0x20,0x20,0x10,0x0F,		// O 47
+	0x08,0xF8,0x08,0x08,0x08,0x08,0xF0,
+	0x20,0x3F,0x21,0x01,0x01,0x01,0x00,		// P 48
+	0xE0,0x10,0x08,0x08,0x08,0x10,0xE0,
+	0x0F,0x18,0x24,0x24,0x38,0x50,0x4F,		// Q 49
+	0x08,0xF8,0x88,0x88,0x88,0x88,0x70,0x00,
+	0x20,0x3F,0x20,0x00,0x03,0x0C,0x30,0x20,		// R 50
+	0x70,0x88,0x08,0x08,0x08,0x38,
+	0x38,0x20,0x21,0x21,0x22,0x1C,		// S 51
+	0x18,0x08,0x08,0xF8,0x08,0x08,0x18,
+	0x00,0x00,0x20,0x3F,0x20,0x00,0x00,		// T 52
+	0x08,0xF8,0x08,0x00,0x00,0x08,0xF8,0x08,
+	0x00,0x1F,0x20,0x20,0x20,0x20,0x1F,0x00,		// U 53
+	0x08,0x78,0x88,0x00,0x00,0xC8,0x38,0x08,
+	0x00,0x00,0x07,0x38,0x0E,0x01,0x00,0x00,		// V 54
+	0xF8,0x08,0x00,0xF8,0x00,0x08,0xF8,
+	0x03,0x3C,0x07,0x00,0x07,0x3C,0x03,		// W 55
+	0x08,0x18,0x68,0x80,0x80,0x68,0x18,0x08,
+	0x20,0x30,0x2C,0x03,0x03,0x2C,0x30,0x20,		// X 56
+	0x08,0x38,0xC8,0x00,0xC8,0x38,0x08,
+	0x00,0x00,0x20,0x3F,0x20,0x00,0x00,		// Y 57
+	0x10,0x08,0x08,0x08,0xC8,0x38,0x08,
+	0x20,0x38,0x26,0x21,0x20,0x20,0x18,		// Z 58
+	0xFE,0x02,0x02,0x02,
+	0x7F,0x40,0x40,0x40,		// [ 59
+	0x0C,0x30,0xC0,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x06,0x38,0xC0,		// \ 60
+	0x02,0x02,0x02,0xFE,
+	0x40,0x40,0x40,0x7F,		// ] 61
+	0x20,0x10,0x08,0x04,0x08,0x10,0x20,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,		// ^ 62
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,		// _ 63
+	0x02,0x04,0x08,
+	0x00,0x00,0x00,		// ` 64
+	0x00,0x80,0x80,0x80,0x80,0x00,0x00,
+	0x19,0x24,0x22,0x22,0x22,0x3F,0x20,		// a 65
+	0x08,0xF8,0x00,0x80,0x80,0x00,0x00,
+	0x00,0x3F,0x11,0x20,0x20,0x11,0x0E,		// b 66
+	0x00,0x00,0x80,0x80,0x80,0x00,
+	0x0E,0x11,0x20,0x20,0x20,0x11,		// c 67
+	0x00,0x00,0x80,0x80,0x88,0xF8,0x00,
+	0x0E,0x11,0x20,0x20,0x10,0x3F,0x20,		// d 68
+	0x00,0x80,0x80,0x80,0x80,0x00,
+	0x1F,0x22,0x22,0x22,0x22,0x13,		// e 69
+	0x80,0x80,0xF0,0x88,0x88,0x88,0x18,
+	0x20,0x20,0x3F,0x20,0x20,0x00,0x00,		// f 70
+	0x00,0x80,0x80,0x80,0x80,0x80,
+	0x6B,0x94,0x94,0x94,0x93,0x60,		// g 71
+	0x08,0xF8,0x00,0x80,0x80,0x80,0x00,0x00,
+	0x20,0x3F,0x21,0x00,0x00,0x20,0x3F,0x20,		// h 72
+	0x80,0x98,0x98,0x00,0x00,
+	0x20,0x20,0x3F,0x20,0x20,		// i 73
+	0x00,0x00,0x80,0x98,0x98,
+	0xC0,0x80,0x80,0x80,0x7F,		// j 74
+	0x08,0xF8,0x00,0x00,0x80,0x80,0x80,
+	0x20,0x3F,0x24,0x02,0x2D,0x30,0x20,		// k 75
+	0x08,0x08,0xF8,0x00,0x00,
+	0x20,0x20,0x3F,0x20,0x20,		// l 76
+	0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,
+	0x20,0x3F,0x20,0x00,0x3F,0x20,0x00,0x3F,		// m 77
+	0x80,0x80,0x00,0x80,0x80,0x00,0x00,
+	0x20,0x3F,0x21,0x00,0x20,0x3F,0x20,		// n 78
+	0x00,0x80,0x80,0x80,0x80,0x00,
+	0x1F,0x20,0x20,0x20,0x20,0x1F,		// o 79
+	0x80,0x80,0x00,0x80,0x80,0x00,0x00,
+	0x80,0xFF,0xA1,0x20,0x20,0x11,0x0E,		// p 80
+	0x00,0x00,0x80,0x80,0x80,0x80,0x00,
+	0x0E,0x11,0x20,0x20,0xA0,0xFF,0x80,		// q 81
+	0x80,0x80,0x80,0x00,0x80,0x80,0x80,
+	0x20,0x20,0x3F,0x21,0x20,0x00,0x01,		// r 82
+	0x00,0x80,0x80,0x80,0x80,0x80,
+	0x33,0x24,0x24,0x24,0x24,0x19,		// s 83
+	0x80,0x80,0xE0,0x80,0x80,
+	0x00,0x00,0x1F,0x20,0x20,		// t 84
+	0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x00,
+	0x00,0x1F,0x20,0x20,0x20,0x10,0x3F,0x20,		// u 85
+	0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,
+	0x00,0x01,0x0E,0x30,0x08,0x06,0x01,0x00,		// v 86
+	0x80,0x80,0x00,0x80,0x00,0x80,0x80,0x80,
+	0x0F,0x30,0x0C,0x03,0x0C,0x30,0x0F,0x00,		// w 87
+	0x80,0x80,0x00,0x80,0x80,0x80,
+	0x20,0x31,0x2E,0x0E,0x31,0x20,		// x 88
+	0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,
+	0x80,0x81,0x8E,0x70,0x18,0x06,0x01,0x00,		// y 89
+	0x80,0x80,0x80,0x80,0x80,0x80,
+	0x21,0x30,0x2C,0x22,0x21,0x30,		// z 90
+	0x80,0x7C,0x02,0x02,
+	0x00,0x3F,0x40,0x40,		// { 91
+	0xFF,
+	0xFF,		// | 92
+	0x02,0x02,0x7C,0x80,
+	0x40,0x40,0x3F,0x00,		// } 93
+	0x80,0x40,0x40,0x80,0x00,0x00,0x80,
+	0x00,0x00,0x00,0x00,0x01,0x01,0x00,		// ~ 94
+};
+
+/*高16像素，宽度可变，字形表（数据偏移，字形宽度）*/
+const OLED_PGlyph_t OLED_PF8x16_Glyph[] =
+{
+	{   0, 4},		//   0
+	{   8, 2},		// ! 1
+	{  12, 5},		// " 2
+	{  22, 7},		// # 3
+	{  36, 5},		// $ 4
+	{  46, 7},		// % 5
+	{  60, 8},		// & 6
+	{  76, 2},		// ' 7
+	{  80, 4},		// ( 8
+	{  88, 4},		// ) 9
+	{  96, 7},		// * 10
+	{ 110, 7},		// + 11
+	{ 124, 2},		// , 12
+	{ 128, 7},		// - 13
+	{ 142, 2},		// . 14
+	{ 146, 7},		// / 15
+	{ 160, 6},		// 0 16
+	{ 172, 5},		// 1 17
+	{ 182, 6},		// 2 18
+	{ 194, 6},		// 3 19
+	{ 206, 6},		// 4 20
+	{ 218, 6},		// 5 21
+	{ 230, 6},		// 6 22
+	{ 242, 6},		// 7 23
+	{ 254, 6},		// 8 24
+	{ 266, 6},		// 9 25
+	{ 278, 2},		// : 26
+	{ 282, 3},		// ; 27
+	{ 288, 6},		// < 28
+	{ 300, 7},		// = 29
+	{ 314, 6},		// > 30
+	{ 326, 6},		// ? 31
+	{ 338, 7},		// @ 32
+	{ 352, 8},		// A 33
+	{ 368, 7},		// B 34
+	{ 382, 7},		// C 35
+	{ 396, 7},		// D 36
+	{ 410, 7},		// E 37
+	{ 424, 7},		// F 38
+	{ 438, 7},		// G 39
+	{ 452, 8},		// H 40
+	{ 468, 5},		// I 41
+	{ 478, 7},		// J 42
+	{ 492, 7},		// K 43
+	{ 506, 7},		// L 44
+	{ 520, 7},		// M 45
+	{ 534, 8},		// N 46
+	{ 550, 7},		// O 47
+	{ 564, 7},		// P 48
+	{ 578, 7},		// Q 49
+	{ 592, 8},		// R 50
+	{ 608, 6},		// S 51
+	{ 620, 7},		// T 52
+	{ 634, 8},		// U 53
+	{ 650, 8},		// V 54
+	{ 666, 7},		// W 55
+	{ 680, 8},		// X 56
+	{ 696, 7},		// Y 57
+	{ 710, 7},		// Z 58
+	{ 724, 4},		// [ 59
+	{ 732, 6},		// \ 60
+	{ 744, 4},		// ] 61
+	{ 752, 7},		// ^ 62
+	{ 766, 8},		// _ 63
+	{ 782, 3},		// ` 64
+	{ 788, 7},		// a 65
+	{ 802, 7},		// b 66
+	{ 816, 6},		// c 67
+	{ 828, 7},		// d 68
+	{ 842, 6},		// e 69
+	{ 854, 7},		// f 70
+	{ 868, 6},		// g 71
+	{ 880, 8},		// h 72
+	{ 896, 5},		// i 73
+	{ 906, 5},		// j 74
+	{ 916, 7},		// k 75
+	{ 930, 5},		// l 76
+	{ 940, 8},		// m 77
+	{ 956, 7},		// n 78
+	{ 970, 6},		// o 79
+	{ 982, 7},		// p 80
+	{ 996, 7},		// q 81
+	{1010, 7},		// r 82
+	{1024, 6},		// s 83
+	{1036, 5},		// t 84
+	{1046, 8},		// u 85
+	{1062, 8},		// v 86
+	{1078, 8},		// w 87
+	{1094, 6},		// x 88
+	{1106, 8},		// y 89
+	{1122, 6},		// z 90
+	{1134, 4},		// { 91
+	{1142, 1},		// | 92
+	{1144, 4},		// } 93
+	{1152, 7},		// ~ 94
+};
+
+/*高16像素，宽度可变，字距调整表，以{0}结尾*/
+const OLED_PKern_t OLED_PF8x16_Kern[] =
+{
+	{'T', 'a', -1}, {'T', 'c', -1}, {'T', 'e', -1}, {'T', 'o', -1}, {'T', '.', -1}, {'T', ',', -1},
+	{'V', 'a', -1}, {'V', 'c', -1}, {'V', 'e', -1}, {'V', 'o', -1}, {'V', '.', -1}, {'V', ',', -1},
+	{'Y', 'a', -1}, {'Y', 'c', -1}, {'Y', 'e', -1}, {'Y', 'o', -1}, {'Y', '.', -1}, {'Y', ',', -1},
+	{0},
+};
+
+/*高16像素比例字体，字间距1像素*/
+const OLED_PFont_t OLED_PF8x16 = {16, 1, ' ', '~', OLED_PF8x16_Glyph, OLED_PF8x16_Data, OLED_PF8x16_Kern};
+
+/*********************比例字体数据*/
+
+
 /*汉字字模数据*********************/
 
 /*相同的汉字只需要定义一次，汉字不分先后顺序*/
@@ -23,10 +23,41 @@ typedef struct
 	uint8_t Data[32];				//字模数据
 } ChineseCell_t;
 
+/*比例字体字形描述*/
+typedef struct
+{
+	uint16_t Offset : 12;			//字形数据在Data数组中的起始下标
+	uint16_t Width : 4;				//字形宽度（列数），范围：1~15
+} OLED_PGlyph_t;
+
+/*比例字体字距调整*/
+typedef struct
+{
+	char Left;						//左侧字符
+	char Right;						//右侧字符
+	int8_t Adjust;					//两字符间距的调整量，负数为收紧
+} OLED_PKern_t;
+
+/*比例字体描述*/
+typedef struct
+{
+	uint8_t Height;					//字体高度，8或16
+	uint8_t Spacing;				//字符间距（列）
+	char First;						//字形表第一个字符
+	char Last;						//字形表最后一个字符
+	const OLED_PGlyph_t *Glyph;		//字形表
+	const uint8_t *Data;			//字形数据，高16像素时每个字形先存上半页Width字节，再存下半页Width字节
+	const OLED_PKern_t *Kern;		//字距调整表，以Left为0的项结尾，可为NULL
+} OLED_PFont_t;
+
 /*ASCII字模数据声明*/
 extern const uint8_t OLED_F8x16[][16];
 extern const uint8_t OLED_F6x8[][6];
 
+/*比例字体数据声明*/
+extern const OLED_PFont_t OLED_PF8x16;
+extern const OLED_PFont_t OLED_PF6x8;
+
 /*汉字字模数据声明*/
 extern const ChineseCell_t OLED_CF16x16[];
 
@@ -0,0 +1,230 @@
+/**
+ ******************************************************************************
+ * @file    OLED_Sched.c
+ * @brief   OLED 限帧刷新调度模块（帧率上限、无变化跳帧、请求合并）
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 主循环直接反复调用 OLED_Update() 会让 I2C 总线与 CPU 一直满载，
+ * 即使画面每秒才变化一次。本模块将刷新改为按帧节拍进行：
+ * - 每页记录一个脏列区间 [Min, Max]，两次帧节拍之间的多次刷新请求
+ *   合并为该区间的并集，一帧只发送一次；
+ * - 帧节拍由定时器中断中的 OLED_Sched_Tick() 产生，帧率不超过设定值；
+ * - 帧节拍到来时若没有脏区域，则跳过该帧，不访问总线；
+ * - 统计实际帧率、累计跳过帧数与丢弃帧数（节拍到来时上一个帧时隙还没开始处理）。
+ *
+ * 多屏幕：
+ * - 脏列区间保存在各自的 OLED_Panel_t 中，刷新请求作用于当前屏幕；
+ * - 发送顺序按页轮转：各屏的第 0 页、各屏的第 1 页……共用总线时
+ *   任何一块屏幕都不会等另一块整屏发送完才开始；
+ * - OLED_SCHED_BUDGET 非 0 时，每次调用最多发送这么多个区间，
+ *   剩余区间在下次调用时从中断处继续，主循环的其他任务不会被整帧阻塞。
+ *
+ * 使用示例：
+ * @code
+ * OLED_Sched_Init(20);                    // 最高 20 帧/秒
+ * while (1)
+ * {
+ *     OLED_ShowNum(0, 0, Count, 3, OLED_8X16);
+ *     OLED_Sched_RequestArea(0, 0, 24, 16);
+ *     OLED_Sched_Process();
+ * }
+ * @endcode
+ *
+ * 依赖：
+ * - OLED.h
+ * - OLED_Sched.h
+ ******************************************************************************
+ */
+
+#include "OLED.h"
+#include "OLED_Sched.h"
+
+/* 当前帧的发送进度（按页轮转） */
+static uint8_t OLED_Sched_Page;                 /**< 正在发送的页 */
+static OLED_Panel_t *OLED_Sched_Panel;          /**< 该页中下一个要检查的屏幕，0 表示从链表头开始 */
+static uint8_t OLED_Sched_Sent;                 /**< 当前帧是否已发送过数据 */
+static uint8_t OLED_Sched_Busy;                 /**< 当前帧已开始但尚未发送完（预算用完分多次发送） */
+
+/* 帧节拍（由定时器中断修改） */
+static uint16_t OLED_Sched_Period;              /**< 帧周期，单位为节拍（ms） */
+static volatile uint16_t OLED_Sched_Count;      /**< 帧周期计数 */
+static volatile uint16_t OLED_Sched_SecCount;   /**< 秒计数，用于统计帧率 */
+static volatile uint8_t OLED_Sched_Due;         /**< 帧时隙已到，等待主循环开始处理 */
+
+/* 统计 */
+static volatile uint8_t OLED_Sched_Fps;
+static volatile uint32_t OLED_Sched_Frames;
+static volatile uint32_t OLED_Sched_Skipped;
+static volatile uint32_t OLED_Sched_Dropped;
+static uint32_t OLED_Sched_FramesLastSec;       /**< 上一秒结束时的 Frames，仅中断使用 */
+
+/**
+ * @brief  初始化刷新调度
+ * @param  Fps 帧率上限（1~255），节拍为 1ms 时实际帧周期为 1000 / Fps 毫秒
+ * @note   初始化后所有屏幕整屏标记为脏，第一帧会完整刷新一次；
+ *         需在 OLED_Init() / OLED_PanelInit() 之后调用。
+ */
+void OLED_Sched_Init(uint8_t Fps){
+	OLED_Panel_t *Saved, *Panel;
+
+	OLED_Sched_Period = 0;      // 先停止节拍，避免中断读到半配置的状态
+
+	OLED_Sched_Count = 0;
+	OLED_Sched_SecCount = 0;
+	OLED_Sched_Due = 0;
+	OLED_Sched_Fps = 0;
+	OLED_Sched_Frames = 0;
+	OLED_Sched_Skipped = 0;
+	OLED_Sched_Dropped = 0;
+	OLED_Sched_FramesLastSec = 0;
+	OLED_Sched_Page = 0;
+	OLED_Sched_Panel = 0;
+	OLED_Sched_Sent = 0;
+	OLED_Sched_Busy = 0;
+
+	Saved = OLED_Current;
+	for(Panel = OLED_PanelList; Panel; Panel = Panel->Next){
+		OLED_Select(Panel);
+		OLED_Sched_Request();
+	}
+	OLED_Select(Saved);
+
+	OLED_Sched_Period = Fps ? 1000 / Fps : 1000;
+}
+
+/**
+ * @brief  请求刷新当前屏幕的整个屏幕
+ * @note   只做标记，实际发送在下一个帧时隙的 OLED_Sched_Process() 中进行。
+ */
+void OLED_Sched_Request(void){
+	uint8_t j;
+	for(j = 0; j < OLED_PAGES; j++){
+		OLED_Current->DirtyMin[j] = 0;
+		OLED_Current->DirtyMax[j] = OLED_WIDTH - 1;
+	}
+}
+
+/**
+ * @brief  请求刷新当前屏幕的指定区域
+ * @param  X, Y, Width, Height 与 OLED_UpdateArea() 参数含义相同，超出屏幕的部分被忽略
+ * @note   多次请求会合并为每页一个连续列区间，同一帧内只发送一次。
+ */
+void OLED_Sched_RequestArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height){
+	int16_t X1 = X + Width - 1, Y1 = Y + Height - 1;
+	int16_t j;
+
+	if(Width == 0 || Height == 0) return;
+	if(OLED_Current->Orientation & OLED_TRANSPOSE){
+		// 旋转 90/270 度时逻辑区域转换为显存区域
+		X1 = X; X = Y; Y = X1;
+		X1 = X + Height - 1; Y1 = Y + Width - 1;
+	}
+	if(X < 0) X = 0;
+	if(Y < 0) Y = 0;
+	if(X1 > OLED_WIDTH - 1) X1 = OLED_WIDTH - 1;
+	if(Y1 > OLED_HEIGHT - 1) Y1 = OLED_HEIGHT - 1;
+	if(X > X1 || Y > Y1) return;
+
+	for(j = Y / 8; j <= Y1 / 8; j++){
+		// 空页为 Min = OLED_WIDTH、Max = 0，直接取并集即可
+		if(X < OLED_Current->DirtyMin[j]) OLED_Current->DirtyMin[j] = X;
+		if(X1 > OLED_Current->DirtyMax[j]) OLED_Current->DirtyMax[j] = X1;
+	}
+}
+
+/**
+ * @brief  帧节拍
+ * @note   在 1ms 周期的定时器中断中调用，只做计数，不访问总线。
+ */
+void OLED_Sched_Tick(void){
+	if(OLED_Sched_Period == 0){
+		return;
+	}
+
+	if(++OLED_Sched_Count >= OLED_Sched_Period){
+		OLED_Sched_Count = 0;
+		if(OLED_Sched_Due){
+			OLED_Sched_Dropped++;       // 上一个帧时隙还没开始处理；正在分次发送的帧不算丢弃
+		}
+		OLED_Sched_Due = 1;
+	}
+
+	if(++OLED_Sched_SecCount >= 1000){
+		OLED_Sched_SecCount = 0;
+		OLED_Sched_Fps = OLED_Sched_Frames - OLED_Sched_FramesLastSec;
+		OLED_Sched_FramesLastSec = OLED_Sched_Frames;
+	}
+}
+
+/**
+ * @brief  刷新处理
+ * @retval 1：本次调用发送了数据
+ * @retval 0：帧时隙未到，或画面无变化被跳过
+ * @note   在主循环中反复调用；每个帧时隙最多发送一帧，且只发送各屏各页的脏列区间。
+ *         返回后当前屏幕保持不变。
+ */
+uint8_t OLED_Sched_Process(void){
+	OLED_Panel_t *Saved, *Panel;
+	uint8_t Min, Count = 0;
+
+	if(OLED_Sched_Busy == 0){
+		if(OLED_Sched_Due == 0){
+			return 0;
+		}
+		// 开始新的一帧：时隙已被取走，发送期间到来的下一个时隙在本帧结束后处理
+		OLED_Sched_Due = 0;
+		OLED_Sched_Busy = 1;
+	}
+
+	Saved = OLED_Current;
+	for(; OLED_Sched_Page < OLED_PAGES; OLED_Sched_Page++){
+		Panel = OLED_Sched_Panel ? OLED_Sched_Panel : OLED_PanelList;
+		for(; Panel; Panel = Panel->Next){
+			Min = Panel->DirtyMin[OLED_Sched_Page];
+			if(Min > Panel->DirtyMax[OLED_Sched_Page]){
+				continue;
+			}
+#if OLED_SCHED_BUDGET
+			if(Count >= OLED_SCHED_BUDGET){
+				OLED_Sched_Panel = Panel;           // 预算用完，下次从这里继续
+				OLED_Sched_Sent = 1;
+				OLED_Select(Saved);
+				return 1;
+			}
+#endif
+			OLED_Select(Panel);
+			OLED_SetCursor(OLED_Sched_Page, Min);
+			OLED_WriteData(&Panel->Buf[OLED_Sched_Page][Min], Panel->DirtyMax[OLED_Sched_Page] - Min + 1);
+			Panel->DirtyMin[OLED_Sched_Page] = OLED_WIDTH;
+			Panel->DirtyMax[OLED_Sched_Page] = 0;
+			Count++;
+		}
+		OLED_Sched_Panel = 0;
+	}
+	OLED_Select(Saved);
+
+	// 所有页都已检查，本帧结束
+	OLED_Sched_Page = 0;
+	OLED_Sched_Busy = 0;
+	if(Count || OLED_Sched_Sent){
+		OLED_Sched_Frames++;
+	}else{
+		OLED_Sched_Skipped++;
+	}
+	OLED_Sched_Sent = 0;
+	return Count != 0;
+}
+
+/**
+ * @brief  读取统计信息
+ * @param  Stats 输出：帧率、累计帧数、跳过帧数、丢弃帧数
+ */
+void OLED_Sched_GetStats(OLED_Sched_Stats_t *Stats){
+	Stats->Fps = OLED_Sched_Fps;
+	Stats->Frames = OLED_Sched_Frames;
+	Stats->Skipped = OLED_Sched_Skipped;
+	Stats->Dropped = OLED_Sched_Dropped;
+}
@@ -0,0 +1,54 @@
+/**
+ ******************************************************************************
+ * @file    OLED_Sched.h
+ * @brief   OLED 限帧刷新调度模块头文件
+ * @note    声明刷新请求、帧节拍与统计查询接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - OLED_Sched_Tick() 需在 1ms 周期的定时器中断中调用；
+ * - 主循环用 OLED_Sched_Request() / OLED_Sched_RequestArea() 代替
+ *   OLED_Update() / OLED_UpdateArea()，并反复调用 OLED_Sched_Process()。
+ * - 多块屏幕时，刷新请求作用于当前屏幕（OLED_Select() 选择），
+ *   OLED_Sched_Process() 轮流发送所有已初始化屏幕的脏区间。
+ ******************************************************************************
+ */
+
+#ifndef __OLED_SCHED_H
+#define __OLED_SCHED_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+#ifndef OLED_SCHED_BUDGET
+#define OLED_SCHED_BUDGET   0       ///< 每次 OLED_Sched_Process() 最多发送的页区间数，0 表示不限
+#endif
+
+/* 统计信息 -----------------------------------------------------------------*/
+typedef struct
+{
+	uint8_t Fps;                ///< 上一秒实际发送的帧数
+	uint32_t Frames;            ///< 累计发送的帧数
+	uint32_t Skipped;           ///< 累计因画面无变化而跳过的帧数
+	uint32_t Dropped;           ///< 累计因主循环未及时开始处理而丢弃的帧时隙（分次发送中的帧不计）
+} OLED_Sched_Stats_t;
+
+/* 函数声明 -----------------------------------------------------------------*/
+void OLED_Sched_Init(uint8_t Fps);
+void OLED_Sched_Request(void);
+void OLED_Sched_RequestArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+void OLED_Sched_Tick(void);
+uint8_t OLED_Sched_Process(void);
+void OLED_Sched_GetStats(OLED_Sched_Stats_t *Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __OLED_SCHED_H */
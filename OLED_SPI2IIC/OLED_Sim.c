@@ -0,0 +1,335 @@
+/**
+ ******************************************************************************
+ * @file    OLED_Sim.c
+ * @brief   SSD1306 主机仿真模块（解码 I2C 字节流、模拟 GDDRAM、快照与总线统计）
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 在 PC 上编译 OLED.c 时（定义 OLED_HOST_SIM），屏幕的传输函数为
+ * OLED_Sim_Write()。本模块像真实的 SSD1306 一样解析收到的字节：
+ * - 控制字节：0x00 命令流、0x40 数据流，支持 Co 位（单字节后再跟控制字节）；
+ * - 命令：页 / 水平 / 垂直三种寻址模式、列与页地址窗口、页模式光标、
+ *   显示开始行、显示偏移、多路复用率、左右 / 上下翻转、反色、全亮、开关显示，
+ *   其余带参数命令按参数个数跳过；
+ * - 数据：按当前寻址模式写入模拟 GDDRAM 并移动光标。
+ *
+ * 屏幕方向约定：0xA1 + 0xC8（OLED_Init 的默认值）为正常方向，
+ * 快照中 (X, Y) 即 OLED_DisplayBuf 中的 (X, Y)。
+ *
+ * 统计：每次调用 OLED_Sim_Write() 记为一个 I2C 事务，总线字节数包括
+ * 从机地址、控制字节与全部数据，可用于衡量传输层优化的效果。
+ *
+ * 依赖：
+ * - OLED.h（屏幕尺寸与列偏移）
+ * - OLED_Sim.h
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "OLED.h"
+#include "OLED_Sim.h"
+
+/* GDDRAM 尺寸：SSD1306 为 128 列，SH1106 为 132 列，均为 8 页 */
+#define OLED_SIM_COLS       (OLED_WIDTH + 2 * OLED_COL_OFFSET)
+#define OLED_SIM_PAGES      8
+
+/* 寻址模式 */
+#define OLED_SIM_HORIZONTAL 0
+#define OLED_SIM_VERTICAL   1
+#define OLED_SIM_PAGE       2
+
+/* 模拟屏幕 */
+typedef struct
+{
+	uint8_t Address;                            /**< I2C 地址，0 表示未使用 */
+	uint8_t RAM[OLED_SIM_PAGES][OLED_SIM_COLS]; /**< GDDRAM */
+	uint8_t Page, Column;                       /**< 写光标 */
+	uint8_t Mode;                               /**< 寻址模式 */
+	uint8_t ColStart, ColEnd;                   /**< 水平 / 垂直模式的列窗口 */
+	uint8_t PageStart, PageEnd;                 /**< 水平 / 垂直模式的页窗口 */
+	uint8_t StartLine, Offset, Mux;             /**< 显示开始行、显示偏移、多路复用率 - 1 */
+	uint8_t SegRemap, ComRemap;                 /**< 0xA1、0xC8 时为 1 */
+	uint8_t Invert, EntireOn, On;
+	uint8_t Cmd[8];                             /**< 正在接收的多字节命令 */
+	uint8_t CmdLen, CmdNeed;
+} OLED_Sim_Device_t;
+
+static OLED_Sim_Device_t OLED_Sim_Devices[OLED_SIM_DEVICES];
+static OLED_Sim_Stats_t OLED_Sim_Stats;
+
+/**
+ * @brief  把模拟屏幕设为上电复位状态
+ */
+static void OLED_Sim_PowerOn(OLED_Sim_Device_t *Dev, uint8_t Address){
+	memset(Dev, 0, sizeof(*Dev));
+	Dev->Address = Address;
+	Dev->Mode = OLED_SIM_PAGE;
+	Dev->ColEnd = OLED_SIM_COLS - 1;
+	Dev->PageEnd = OLED_SIM_PAGES - 1;
+	Dev->Mux = 63;
+}
+
+/**
+ * @brief  按地址查找模拟屏幕
+ * @param  Create 1：不存在时分配一块新屏幕
+ */
+static OLED_Sim_Device_t *OLED_Sim_Find(uint8_t Address, uint8_t Create){
+	uint8_t i;
+
+	for(i = 0; i < OLED_SIM_DEVICES; i++){
+		if(OLED_Sim_Devices[i].Address == Address){
+			return &OLED_Sim_Devices[i];
+		}
+	}
+	if(Create){
+		for(i = 0; i < OLED_SIM_DEVICES; i++){
+			if(OLED_Sim_Devices[i].Address == 0){
+				OLED_Sim_PowerOn(&OLED_Sim_Devices[i], Address);
+				return &OLED_Sim_Devices[i];
+			}
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief  命令需要的参数字节数
+ */
+static uint8_t OLED_Sim_ParamCount(uint8_t Cmd){
+	switch(Cmd){
+		case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xAD:
+		case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+			return 1;
+		case 0x21: case 0x22: case 0xA3:
+			return 2;
+		case 0x29: case 0x2A:
+			return 5;
+		case 0x26: case 0x27:
+			return 6;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @brief  执行一条完整的命令
+ */
+static void OLED_Sim_Execute(OLED_Sim_Device_t *Dev){
+	uint8_t *c = Dev->Cmd;
+
+	if(c[0] <= 0x0F){
+		Dev->Column = (Dev->Column & 0xF0) | (c[0] & 0x0F);     // 页模式列地址低 4 位
+	}else if(c[0] <= 0x1F){
+		Dev->Column = (Dev->Column & 0x0F) | ((c[0] & 0x0F) << 4);  // 页模式列地址高 4 位
+	}else if(c[0] >= 0x40 && c[0] <= 0x7F){
+		Dev->StartLine = c[0] & 0x3F;
+	}else if(c[0] >= 0xB0 && c[0] <= 0xB7){
+		Dev->Page = c[0] & 0x07;
+	}else{
+		switch(c[0]){
+			case 0x20: Dev->Mode = c[1] & 0x03; break;
+			case 0x21:
+				Dev->ColStart = Dev->Column = c[1] % OLED_SIM_COLS;
+				Dev->ColEnd = c[2] % OLED_SIM_COLS;
+				break;
+			case 0x22:
+				Dev->PageStart = Dev->Page = c[1] & 0x07;
+				Dev->PageEnd = c[2] & 0x07;
+				break;
+			case 0xA0: case 0xA1: Dev->SegRemap = c[0] & 0x01; break;
+			case 0xA4: case 0xA5: Dev->EntireOn = c[0] & 0x01; break;
+			case 0xA6: case 0xA7: Dev->Invert = c[0] & 0x01; break;
+			case 0xA8: Dev->Mux = c[1] & 0x3F; break;
+			case 0xAE: case 0xAF: Dev->On = c[0] & 0x01; break;
+			case 0xC0: Dev->ComRemap = 0; break;
+			case 0xC8: Dev->ComRemap = 1; break;
+			case 0xD3: Dev->Offset = c[1] & 0x3F; break;
+			default: break;                                 // 对比度、时钟、充电泵、滚动等不影响显存
+		}
+	}
+}
+
+/**
+ * @brief  接收一个命令字节
+ */
+static void OLED_Sim_Command(OLED_Sim_Device_t *Dev, uint8_t Byte){
+	if(Dev->CmdLen == 0){
+		Dev->CmdNeed = 1 + OLED_Sim_ParamCount(Byte);
+	}
+	Dev->Cmd[Dev->CmdLen++] = Byte;
+	if(Dev->CmdLen >= Dev->CmdNeed){
+		OLED_Sim_Execute(Dev);
+		Dev->CmdLen = 0;
+	}
+	OLED_Sim_Stats.Commands++;
+}
+
+/**
+ * @brief  接收一个显存数据字节并按寻址模式移动光标
+ */
+static void OLED_Sim_DataByte(OLED_Sim_Device_t *Dev, uint8_t Byte){
+	Dev->RAM[Dev->Page][Dev->Column] = Byte;
+	OLED_Sim_Stats.Data++;
+
+	switch(Dev->Mode){
+		case OLED_SIM_HORIZONTAL:
+			if(Dev->Column >= Dev->ColEnd){
+				Dev->Column = Dev->ColStart;
+				Dev->Page = Dev->Page >= Dev->PageEnd ? Dev->PageStart : Dev->Page + 1;
+			}else{
+				Dev->Column++;
+			}
+			break;
+
+		case OLED_SIM_VERTICAL:
+			if(Dev->Page >= Dev->PageEnd){
+				Dev->Page = Dev->PageStart;
+				Dev->Column = Dev->Column >= Dev->ColEnd ? Dev->ColStart : Dev->Column + 1;
+			}else{
+				Dev->Page++;
+			}
+			break;
+
+		default:                                            // 页模式：到达行尾后停在本页回绕
+			Dev->Column = Dev->Column >= OLED_SIM_COLS - 1 ? 0 : Dev->Column + 1;
+			break;
+	}
+}
+
+/**
+ * @brief  模拟传输函数：一次调用为一个 I2C 事务
+ * @param  Address 从机地址（8 位写地址）
+ * @param  Control 第一个控制字节
+ * @param  Data    控制字节之后的字节
+ * @param  Count   Data 的字节数
+ * @note   与 OLED_Panel_t.Write 的原型相同，可直接作为屏幕的传输函数。
+ */
+void OLED_Sim_Write(uint8_t Address, uint8_t Control, const uint8_t *Data, uint8_t Count){
+	OLED_Sim_Device_t *Dev = OLED_Sim_Find(Address, 1);
+	uint8_t i, Single;
+
+	OLED_Sim_Stats.Transactions++;
+	OLED_Sim_Stats.Bytes += 2 + Count;                      // 地址 + 控制字节 + 数据
+
+	if(Dev == 0){
+		return;                                             // 没有空闲的模拟屏幕，相当于无应答
+	}
+
+	for(i = 0; i < Count; i++){
+		Single = Control & 0x80;                            // Co = 1：只跟一个字节，随后又是控制字节
+		if(Control & 0x40){
+			OLED_Sim_DataByte(Dev, Data[i]);
+		}else{
+			OLED_Sim_Command(Dev, Data[i]);
+		}
+		if(Single && i + 1 < Count){
+			Control = Data[++i];
+		}
+	}
+}
+
+/**
+ * @brief  清除所有模拟屏幕与统计
+ */
+void OLED_Sim_Reset(void){
+	memset(OLED_Sim_Devices, 0, sizeof(OLED_Sim_Devices));
+	OLED_Sim_ResetStats();
+}
+
+/**
+ * @brief  清零总线统计
+ */
+void OLED_Sim_ResetStats(void){
+	memset(&OLED_Sim_Stats, 0, sizeof(OLED_Sim_Stats));
+}
+
+/**
+ * @brief  读取总线统计
+ */
+void OLED_Sim_GetStats(OLED_Sim_Stats_t *Stats){
+	*Stats = OLED_Sim_Stats;
+}
+
+/**
+ * @brief  读取屏幕上 (X, Y) 处实际显示的像素
+ * @note   依次考虑开关显示、全亮、左右 / 上下翻转、开始行、偏移与反色。
+ * @retval 1：点亮，0：熄灭或超出屏幕
+ */
+uint8_t OLED_Sim_GetPixel(uint8_t Address, uint8_t X, uint8_t Y){
+	OLED_Sim_Device_t *Dev = OLED_Sim_Find(Address, 0);
+	uint8_t Col, Com, Row, Bit;
+
+	if(Dev == 0 || X >= OLED_WIDTH || Y >= OLED_HEIGHT || Y > Dev->Mux || !Dev->On){
+		return 0;
+	}
+	if(Dev->EntireOn){
+		return 1;
+	}
+
+	Col = Dev->SegRemap ? OLED_COL_OFFSET + X : OLED_SIM_COLS - 1 - OLED_COL_OFFSET - X;
+	Com = Dev->ComRemap ? Y : Dev->Mux - Y;
+	Row = (Com + Dev->Offset + Dev->StartLine) & 0x3F;
+	Bit = (Dev->RAM[Row / 8][Col] >> (Row % 8)) & 0x01;
+
+	return Bit ^ Dev->Invert;
+}
+
+/**
+ * @brief  读取模拟 GDDRAM 的一页（从可见区域第一列开始）
+ * @retval 该页数据指针，屏幕不存在时为 NULL
+ */
+const uint8_t *OLED_Sim_GetRAM(uint8_t Address, uint8_t Page){
+	OLED_Sim_Device_t *Dev = OLED_Sim_Find(Address, 0);
+
+	if(Dev == 0 || Page >= OLED_SIM_PAGES){
+		return 0;
+	}
+	return &Dev->RAM[Page][OLED_COL_OFFSET];
+}
+
+/**
+ * @brief  计算屏幕显示内容的 32 位 FNV-1a 哈希，用作金样比对
+ */
+uint32_t OLED_Sim_Hash(uint8_t Address){
+	uint32_t Hash = 2166136261UL;
+	uint8_t X, Y;
+
+	for(Y = 0; Y < OLED_HEIGHT; Y++){
+		for(X = 0; X < OLED_WIDTH; X++){
+			Hash = (Hash ^ OLED_Sim_GetPixel(Address, X, Y)) * 16777619UL;
+		}
+	}
+	return Hash;
+}
+
+/**
+ * @brief  把屏幕显示内容保存为 PBM（P4）图像，点亮的像素为黑色
+ * @retval 0：成功，-1：文件打开失败
+ */
+int OLED_Sim_SavePBM(uint8_t Address, const char *Path){
+	FILE *f = fopen(Path, "wb");
+	uint8_t X, Y, Byte;
+
+	if(f == 0){
+		return -1;
+	}
+	fprintf(f, "P4\n%d %d\n", OLED_WIDTH, OLED_HEIGHT);
+	for(Y = 0; Y < OLED_HEIGHT; Y++){
+		Byte = 0;
+		for(X = 0; X < OLED_WIDTH; X++){
+			Byte = (Byte << 1) | OLED_Sim_GetPixel(Address, X, Y);
+			if(X % 8 == 7){
+				fputc(Byte, f);
+				Byte = 0;
+			}
+		}
+		if(OLED_WIDTH % 8){
+			fputc(Byte << (8 - OLED_WIDTH % 8), f);
+		}
+	}
+	fclose(f);
+	return 0;
+}
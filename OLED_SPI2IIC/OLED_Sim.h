@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * @file    OLED_Sim.h
+ * @brief   SSD1306 主机仿真模块头文件
+ * @note    声明模拟传输函数、显示快照与总线统计接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 仅用于 PC（Linux）构建，编译时定义 OLED_HOST_SIM，
+ *   OLED.c 的默认传输函数即变为 OLED_Sim_Write()；
+ * - 每个 I2C 地址对应一块模拟屏幕，最多 OLED_SIM_DEVICES 块。
+ ******************************************************************************
+ */
+
+#ifndef __OLED_SIM_H
+#define __OLED_SIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+#ifndef OLED_SIM_DEVICES
+#define OLED_SIM_DEVICES    2           ///< 模拟屏幕数量（不同 I2C 地址）
+#endif
+
+/* 总线统计 -----------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t Transactions;              ///< I2C 事务数（起始到终止）
+	uint32_t Bytes;                     ///< 总线字节数（含地址与控制字节）
+	uint32_t Commands;                  ///< 命令字节数
+	uint32_t Data;                      ///< 显存数据字节数
+} OLED_Sim_Stats_t;
+
+/* 函数声明 -----------------------------------------------------------------*/
+void OLED_Sim_Write(uint8_t Address, uint8_t Control, const uint8_t *Data, uint8_t Count);
+
+void OLED_Sim_Reset(void);
+void OLED_Sim_ResetStats(void);
+void OLED_Sim_GetStats(OLED_Sim_Stats_t *Stats);
+
+uint8_t OLED_Sim_GetPixel(uint8_t Address, uint8_t X, uint8_t Y);
+const uint8_t *OLED_Sim_GetRAM(uint8_t Address, uint8_t Page);
+uint32_t OLED_Sim_Hash(uint8_t Address);
+int OLED_Sim_SavePBM(uint8_t Address, const char *Path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __OLED_SIM_H */
@@ -10,22 +10,24 @@
 
 
 /*EXTI_Init test*/
-int Count = 0;
+/*每条线路一个计数器，回调只写自己的计数器，两个优先级不同的中断互相抢占也不会丢失计数*/
+volatile uint16_t Count_PA3 = 0;
+volatile uint16_t Count_PB12 = 0;
+
+void Count_Add(void *Ctx)
+{
+	(*(volatile uint16_t *)Ctx) ++;
+}
+
 int main(void)
 {
 	OLED_Init();
-	EXTI_GPIOA_Init(3);
+	EXTI_Register(GPIOA, 3, EXTI_Trigger_Falling, 2, Count_Add, (void *)&Count_PA3);          // PA3 下降沿计数
+	EXTI_Register(GPIOB, 12, EXTI_Trigger_Rising_Falling, 1, Count_Add, (void *)&Count_PB12); // PB12 双边沿计数
 	while(1)
 	{
-		OLED_ShowNum(0, 0, Count, 3, OLED_8X16);
+		OLED_ShowNum(0, 0, Count_PA3, 5, OLED_8X16);
+		OLED_ShowNum(0, 16, Count_PB12, 5, OLED_8X16);
 		OLED_Update();
 	}
 }
-
-
-void EXTI3_IRQHandler(void){
-	if(EXTI_GetITStatus(EXTI_Line3) == SET){
-		Count ++;
-		EXTI_ClearFlag(EXTI_Line3);
-	}
-}
@@ -0,0 +1,30 @@
+#include "stm32f10x.h"                  // Device header
+#include "OLED.h"
+#include "PWM.h"
+#include "MyDWT.h"
+#include "EdgeCapture.h"
+
+/* PA0 输出 1kHz PWM（TIM2_CH1），用杜邦线接到 PB12 进行测量 */
+
+int main(void){
+	EdgeCapture_Stats_t Stats;
+	uint8_t Channel;
+	
+	OLED_Init();
+	PWM_Init();
+	TIM_SetCompare1(TIM2, 30);      // 30% 占空比
+	
+	Channel = EdgeCapture_Add(GPIOB, 12, EXTI_Trigger_Rising_Falling, 1);
+	
+	while(1){
+		EdgeCapture_Process();
+		EdgeCapture_GetStats(Channel, &Stats);
+		
+		OLED_Printf(0, 0, OLED_6X8, "F:%lu.%03luHz   ", Stats.Frequency / 1000, Stats.Frequency % 1000);
+		OLED_Printf(0, 8, OLED_6X8, "T:%luus   ", MyDWT_CyclesToUs(Stats.PeriodMean));
+		OLED_Printf(0, 16, OLED_6X8, "D:%u.%u%%   ", Stats.Duty / 10, Stats.Duty % 10);
+		OLED_Printf(0, 24, OLED_6X8, "Jpp:%lu Jrms:%lu   ", Stats.PeriodMax - Stats.PeriodMin, Stats.JitterRms);
+		OLED_Printf(0, 32, OLED_6X8, "N:%lu Drop:%lu", Stats.Periods, Stats.Dropped);
+		OLED_Update();
+	}
+}
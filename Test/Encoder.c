@@ -0,0 +1,34 @@
+#include "stm32f10x.h"                  // Device header
+#include "OLED.h"
+#include "Key_Full.h"
+
+/* 需在 Key_Full.h 中定义 KEY_ENCODER */
+
+int main(void){
+	int16_t Value = 0;
+	
+	Key_Init();
+	OLED_Init();
+	
+	while(1){
+		Value += Encoder_GetDelta();
+		if(Key_Check(KEY_ENC, KEY_SINGLE)){
+			Value = 0;
+		}
+		if(Key_Check(KEY_ENC, KEY_LONG)){
+			Encoder_SetPosition(0);
+		}
+		OLED_Printf(0, 0, OLED_8X16, "Val:%6d", Value);
+		OLED_Printf(0, 16, OLED_8X16, "Pos:%6ld", Encoder_GetPosition());
+		OLED_Printf(0, 32, OLED_8X16, "Vel:%6ld", Encoder_GetVelocity());
+		OLED_Update();
+	}
+}
+
+
+void TIM1_UP_IRQHandler(void){
+	if(TIM_GetITStatus(TIM1, TIM_IT_Update) == SET){
+		Key_Tick();
+		TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+	}
+}
@@ -0,0 +1,66 @@
+#include "stm32f10x.h"                  // Device header
+#include "Delay.h"
+#include "OLED.h"
+#include "Key_Full.h"
+#include "Timer.h"
+#include "EXTI_Init.h"
+#include "IrqLatency.h"
+
+/* 需在 IrqLatency.h 中打开 IRQ_LATENCY
+ * TIM1（按键扫描）、TIM2（定时器）、EXTI15_10（PB12，软件触发）抢占优先级均为 2，
+ * 主循环每 1ms 软件触发一次 EXTI，OLED 显示各中断的延迟与执行时间（单位：周期） */
+
+static uint8_t Row;
+volatile uint32_t ExtiCount;
+
+static void Print(const char *Line){
+	if(Row < 64){
+		OLED_ShowString(0, Row, (char *)Line, OLED_6X8);
+		Row += 8;
+	}
+}
+
+static void Exti_Callback(void *Ctx){
+	(void)Ctx;
+	ExtiCount++;
+}
+
+int main(void){
+	uint16_t Loop = 0;
+	
+	OLED_Init();
+	IrqLatency_Init();
+	
+	Key_Init();
+	Timer_Init();
+	TIM_PrescalerConfig(TIM2, 72 - 1, TIM_PSCReloadMode_Immediate);    // 1MHz 计数，10ms 中断，分辨率 72 周期
+	IrqLatency_AttachTimer(IRQLAT_TIM1_UP, TIM1);
+	IrqLatency_AttachTimer(IRQLAT_TIM2, TIM2);
+	
+	EXTI_Register(GPIOB, 12, EXTI_Trigger_Falling, 2, Exti_Callback, 0);
+	
+	while(1){
+		IrqLatency_TriggerEXTI(IRQLAT_EXTI15_10, 12);
+		Delay_ms(1);
+		
+		if(++Loop >= 500){
+			Loop = 0;
+			OLED_Clear();
+			Row = 0;
+			IrqLatency_Report(Print);
+			OLED_Update();
+		}
+		if(Key_Check(KEY_1, KEY_SINGLE)){
+			IrqLatency_Reset();
+		}
+	}
+}
+
+void TIM1_UP_IRQHandler(void){
+	IRQ_LATENCY_ENTER(IRQLAT_TIM1_UP);
+	if(TIM_GetITStatus(TIM1, TIM_IT_Update) == SET){
+		Key_Tick();
+		TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+	}
+	IRQ_LATENCY_EXIT(IRQLAT_TIM1_UP);
+}
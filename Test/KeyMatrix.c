@@ -0,0 +1,36 @@
+#include "stm32f10x.h"                  // Device header
+#include "OLED.h"
+#include "Key_Full.h"
+#include "KeyEvent.h"
+
+/* 需在 Key_Full.h 中定义 KEY_MATRIX */
+
+int main(void){
+	KeyEvent_t Event;
+	uint8_t Row = 0;
+	
+	Key_Init();
+	OLED_Init();
+	
+	while(1){
+		while(KeyEvent_Pop(&Event)){
+			if(Event.Key >= KEY_COUNT && Event.Event != KEY_DOWN && Event.Event != KEY_UP){
+				OLED_Printf(0, Row * 8, OLED_6X8, "R%d C%d %-6s   ",
+				            (Event.Key - KEY_COUNT) / KEYMATRIX_COLS, (Event.Key - KEY_COUNT) % KEYMATRIX_COLS,
+				            Event.Event == KEY_SINGLE ? "SINGLE" : Event.Event == KEY_DOUBLE ? "DOUBLE" :
+				            Event.Event == KEY_LONG ? "LONG" : "REPEAT");
+				Row = (Row + 1) % 7;
+			}
+		}
+		OLED_Printf(0, 56, OLED_6X8, "Ghost:%lu", KeyMatrix_GetGhosts());
+		OLED_Update();
+	}
+}
+
+
+void TIM1_UP_IRQHandler(void){
+	if(TIM_GetITStatus(TIM1, TIM_IT_Update) == SET){
+		Key_Tick();
+		TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+	}
+}
@@ -8,6 +8,7 @@
 #include "MyAD.h"
 #include "MyRTC.h"
 #include "Key_Full.h"
+#include "KeyEvent.h"
 
 
 int main(void){
@@ -17,7 +18,7 @@ int main(void){
 	GPIO_SetBits(GPIOC, GPIO_Pin_13);
 	/* HOLD test */
 //	while(1){
-//		if(Key_Check(KEY_HOLD)){
+//		if(Key_Check(KEY_1, KEY_HOLD)){
 //			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
 //		}else{
 //			GPIO_SetBits(GPIOC, GPIO_Pin_13);
@@ -26,7 +27,7 @@ int main(void){
 	
 	/* DOWM test */
 //	while(1){
-//		if(Key_Check(KEY_DOWN)){
+//		if(Key_Check(KEY_1, KEY_DOWN)){
 //			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
 //			Delay_ms(500);
 //		}else{
@@ -36,7 +37,7 @@ int main(void){
 
 	/* UP test */
 //	while(1){
-//		if(Key_Check(KEY_UP)){
+//		if(Key_Check(KEY_1, KEY_UP)){
 //			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
 //			Delay_ms(500);
 //		}else{
@@ -46,7 +47,7 @@ int main(void){
 
   	/* SINGLE test */
 //	while(1){
-//		if(Key_Check(KEY_SINGLE)){
+//		if(Key_Check(KEY_1, KEY_SINGLE)){
 //			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
 //			Delay_ms(500);
 //		}else{
@@ -56,7 +57,7 @@ int main(void){
 
   	/* DOUBLE test */
 //	while(1){
-//		if(Key_Check(KEY_DOUBLE)){
+//		if(Key_Check(KEY_1, KEY_DOUBLE)){
 //			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
 //			Delay_ms(500);
 //		}else{
@@ -66,7 +67,7 @@ int main(void){
 
 	/* LONG test */
 //	while(1){
-//		if(Key_Check(KEY_LONG)){
+//		if(Key_Check(KEY_1, KEY_LONG)){
 //			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
 //			Delay_ms(500);
 //		}else{
@@ -76,12 +77,61 @@ int main(void){
 
 	/* REPEAT test */
 //	while(1){
-//		if(Key_Check(KEY_REPEAT)){
+//		if(Key_Check(KEY_1, KEY_REPEAT)){
 //			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
 //			Delay_ms(1);
 //		}else{
 //			GPIO_SetBits(GPIOC, GPIO_Pin_13);
 //		}
+//	}
+
+	/* MULTI test: 最多识别五击，连击从 300ms 逐步加速到 50ms */
+//	Key_Timing_t Timing = {1000, 250, 300, 50, 25, 5};
+//	Key_SetTiming(KEY_1, &Timing);
+//	while(1){
+//		if(Key_Check(KEY_1, KEY_MULTI)){
+//			OLED_ShowNum(0, 0, Key_GetClicks(KEY_1), 1, OLED_8X16);
+//			OLED_Update();
+//		}
+//		if(Key_Check(KEY_1, KEY_REPEAT)){
+//			GPIO_WriteBit(GPIOC, GPIO_Pin_13, (BitAction)!GPIO_ReadOutputDataBit(GPIOC, GPIO_Pin_13));
+//		}
+//	}
+
+	/* Multi-key test: KEY_1 单击点亮，KEY_2 单击熄灭 */
+//	while(1){
+//		if(Key_Check(KEY_1, KEY_SINGLE)){
+//			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
+//		}
+//		if(Key_Check(KEY_2, KEY_SINGLE)){
+//			GPIO_SetBits(GPIOC, GPIO_Pin_13);
+//		}
+//	}
+
+	/* Low power test: Key_Full.h 中定义 KEY_WAKE_EXTI，空闲时 TIM1 停止，CPU 休眠 */
+//	while(1){
+//		if(Key_Check(KEY_1, KEY_SINGLE)){
+//			GPIO_ResetBits(GPIOC, GPIO_Pin_13);
+//		}
+//		if(Key_Check(KEY_1, KEY_DOUBLE)){
+//			GPIO_SetBits(GPIOC, GPIO_Pin_13);
+//		}
+//		__WFI();
+//	}
+
+	/* Event queue test: 主循环每 500ms 才处理一次，按键事件不丢失 */
+//	KeyEvent_t Event;
+//	KeyEvent_Stats_t Stats;
+//	uint8_t Row = 0;
+//	while(1){
+//		while(KeyEvent_Pop(&Event)){
+//			OLED_Printf(0, Row * 8, OLED_6X8, "K%d E%02X T%lu   ", Event.Key, Event.Event, Event.Tick);
+//			Row = (Row + 1) % 6;
+//		}
+//		KeyEvent_GetStats(&Stats);
+//		OLED_Printf(0, 48, OLED_6X8, "Max%2d Drop%lu", Stats.MaxUsed, Stats.Dropped);
+//		OLED_Update();
+//		Delay_ms(500);
 //	}
 
 }
@@ -0,0 +1,55 @@
+#include "stm32f10x.h"                  // Device header
+#include "Delay.h"
+#include "GPIO_Init.h"
+#include "OLED.h"
+#include "Key_Full.h"
+#include "KeyEvent.h"
+#include "Menu.h"
+
+
+/*Menu test*/
+int16_t Brightness = 50, Contrast = 128, Timeout = 30;
+
+void Led_Toggle(void){
+	GPIO_WriteBit(GPIOC, GPIO_Pin_13, (BitAction)!GPIO_ReadInputDataBit(GPIOC, GPIO_Pin_13));
+}
+
+const Menu_Item_t DisplayItems[] = {
+	{"Brightness", MENU_VALUE, 0, &Brightness, 0, 100, 1, 0},
+	{"Contrast",   MENU_VALUE, 0, &Contrast,   0, 255, 5, 0},
+	{"Back",       MENU_BACK},
+};
+const Menu_Page_t DisplayPage = {"Display", DisplayItems, 3};
+
+const Menu_Item_t MainItems[] = {
+	{"Display",    MENU_SUBMENU, &DisplayPage},
+	{"Timeout",    MENU_VALUE,   0, &Timeout, 5, 600, 5, 0},
+	{"Toggle LED", MENU_ACTION,  0, 0, 0, 0, 0, Led_Toggle},
+};
+const Menu_Page_t MainPage = {"Settings", MainItems, 3};
+
+int main(void){
+	KeyEvent_t Event;
+	
+	Key_Init();
+	OLED_Init();
+	Indicator_Light_Init();
+	
+	Menu_Init(&MainPage);
+	while(1){
+		while(KeyEvent_Pop(&Event)){
+			if(!Menu_HandleKey(&Event) && Event.Key == KEY_2 && Event.Event == KEY_SINGLE){
+				Led_Toggle();               // 菜单以外的按键由应用程序自己处理
+			}
+		}
+		Menu_Process();
+	}
+}
+
+
+void TIM1_UP_IRQHandler(void){
+	if(TIM_GetITStatus(TIM1, TIM_IT_Update) == SET){
+		Key_Tick();
+		TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+	}
+}
@@ -0,0 +1,54 @@
+#include "stm32f10x.h"                  // Device header
+#include "Delay.h"
+#include "OLED.h"
+#include "MyI2C.h"
+
+
+/*MyI2C test*/
+/*MPU6050 与 OLED 挂在同一条总线（PB8 / PB9）上*/
+/*加速度读取以事务形式提交，由主循环的 MyI2C_Process() 执行，不等待结果*/
+
+#define MPU6050_ADDRESS		0xD0
+
+uint8_t AccelBuf[6];
+uint16_t ReadCount;
+
+void Accel_Done(MyI2C_Xfer_t *Xfer)
+{
+	if (Xfer->Status == MYI2C_OK)
+	{
+		ReadCount ++;
+	}
+}
+
+MyI2C_Xfer_t AccelXfer = {MPU6050_ADDRESS, MYI2C_FLAG_REG, 0x3B, 0, 0, AccelBuf, 6, Accel_Done, MYI2C_OK};
+
+int main(void)
+{
+	uint8_t ID = 0, Data = 0x00, Status;
+
+	OLED_Init();
+	MyI2C_Init();
+
+	Status = MyI2C_WriteReg(MPU6050_ADDRESS, 0x6B, &Data, 1);		//解除睡眠
+	MyI2C_ReadReg(MPU6050_ADDRESS, 0x75, &ID, 1);					//WHO_AM_I
+
+	OLED_Printf(0, 0, OLED_6X8, "Status:%d ID:%02X", Status, ID);
+	OLED_Update();
+
+	while(1)
+	{
+		/*上一次读取完成后再提交下一次*/
+		if (AccelXfer.Status != MYI2C_PENDING)
+		{
+			MyI2C_Submit(&AccelXfer);
+		}
+		MyI2C_Process();
+
+		OLED_Printf(0, 16, OLED_6X8, "AX:%6d", (int16_t)(AccelBuf[0] << 8 | AccelBuf[1]));
+		OLED_Printf(0, 24, OLED_6X8, "AY:%6d", (int16_t)(AccelBuf[2] << 8 | AccelBuf[3]));
+		OLED_Printf(0, 32, OLED_6X8, "AZ:%6d", (int16_t)(AccelBuf[4] << 8 | AccelBuf[5]));
+		OLED_Printf(0, 48, OLED_6X8, "Reads:%5d", ReadCount);
+		OLED_Update();		//定义OLED_I2C_BUS时，每页数据之间会穿插执行已提交的读取
+	}
+}
@@ -0,0 +1,39 @@
+#include "stm32f10x.h"                  // Device header
+#include "Delay.h"
+#include "GPIO_Init.h"
+#include "OLED.h"
+#include "OLED_Anim.h"
+#include "Key_Full.h"
+
+
+/*OLED_Anim test*/
+/*进度条动画：以当前（清空的）显存为起点，每帧只追加 16 列，共 4 帧*/
+const uint8_t Bar_Delta[] = {
+	1,	3, 0,  16,	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	1,	3, 16, 16,	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	1,	3, 32, 16,	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	2,	3, 48, 16,	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+		5, 56, 16,	0x7E,0x81,0x81,0x7E,0x00,0xFF,0x08,0x14,0x22,0x41,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const OLED_Anim_t Bar_Anim = {0, Bar_Delta, 4, 200};
+
+int main(void)
+{
+	OLED_Init();
+	Key_Init();		// 借用 Key_Init 配置的 TIM1 1ms 中断作为动画节拍
+	
+	OLED_Anim_Start(&Bar_Anim, OLED_ANIM_ONCE);
+	while(1)
+	{
+		OLED_Anim_Process();
+	}
+}
+
+
+void TIM1_UP_IRQHandler(void){
+	if(TIM_GetITStatus(TIM1, TIM_IT_Update) == SET){
+		OLED_Anim_Tick();
+		TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+	}
+}
@@ -0,0 +1,323 @@
+/**
+ * OLED_Bench test（绘图函数微基准）
+ *
+ * 每个函数在三种参数下各测一组：
+ *   random    随机坐标，范围覆盖屏幕内外（含负坐标）
+ *   worst     屏幕内工作量最大的参数（全屏对角线、最大半径填充圆等）
+ *   offscreen 完全在屏幕外的参数（含负坐标），衡量裁剪的开销
+ * 参数由固定种子的伪随机数预先生成，计时不包含参数生成；每组重复 BENCH_RUNS 次取最小值。
+ *
+ * 绝对耗时随机器、编译器和主频变化，因此每组之前先测一次与 OLED 代码无关的参考负载
+ * （Bench_Reference，固定的缓冲区读改写循环），rel 列为 per_op 相对参考负载的千分比，
+ * 基准与比较都只使用 rel。
+ *
+ * 报告为CSV，每行：name,case,unit,per_op,rel,baseline,status
+ * rel 超过基准值 (100 + BENCH_TOLERANCE)% 再加 BENCH_SLACK 时 status 为 FAIL，
+ * 没有基准值时 status 为 SKIP，最后一行汇总失败数与跳过数。
+ *
+ * PC（ns/op）：
+ *   gcc -O2 -DOLED_HOST_SIM -IOLED_SPI2IIC Test/OLED_Bench.c OLED_SPI2IIC/OLED.c \
+ *       OLED_SPI2IIC/OLED_Data.c OLED_SPI2IIC/OLED_Sim.c -lm -o oled_bench
+ *   ./oled_bench                与 Test/OLED_Bench_Host.csv 比较
+ *   ./oled_bench base.csv       与指定基准比较
+ *   ./oled_bench -w base.csv    记录基准
+ *   返回值：0 全部通过，1 有退化，2 有用例缺少基准或基准文件无法打开。
+ *   入库的 Test/OLED_Bench_Host.csv 只记录 rel，取自 x86-64 gcc -O2 下 10 次运行的最大值；
+ *   rel 仍会随 CPU 架构和编译器略有变化，PC 计时波动也大，容差相应放宽。
+ *
+ * 目标板（DWT cycles/op）：
+ *   与 OLED.c、OLED_Data.c、MyDWT.c 一起编译，报告经 printf 从 ITM（SWO）输出。
+ *   目标板只输出报告，不做退化检查（没有在板上实测过的基准），baseline 列为 0，status 为 "-"；
+ *   需要比较时把两次输出的 rel 列对照即可。结束后屏幕显示 Bench done。
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "OLED.h"
+
+#ifdef OLED_HOST_SIM
+
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_UNIT			"ns"
+#define BENCH_REPEAT		10			//每次计时内重复整组参数的次数
+#define BENCH_RUNS			15			//重复计时次数，取最小值（多取几次以排除进程调度的干扰）
+#define BENCH_TOLERANCE		50			//允许的退化百分比（PC 计时抖动较大）
+#define BENCH_SLACK			50			//允许的绝对退化（rel，千分比），避免极短用例被计时抖动误判
+#define BENCH_BASELINE		"Test/OLED_Bench_Host.csv"	//默认基准文件
+
+static uint32_t Bench_Now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+#else
+
+#include "stm32f10x.h"
+#include "MyDWT.h"
+
+#define BENCH_UNIT			"cycles"
+#define BENCH_REPEAT		1
+#define BENCH_RUNS			5			//重复计时次数，取最小值
+
+#define Bench_Now()			MyDWT_GetCycles()
+
+/*printf重定向到ITM，通过SWO查看报告*/
+int fputc(int ch, FILE *f)
+{
+	(void)f;
+	ITM_SendChar(ch);
+	return ch;
+}
+
+#endif
+
+#define BENCH_ARGS			32			//每组参数个数
+
+#define BENCH_RANDOM		0
+#define BENCH_WORST			1
+#define BENCH_OFFSCREEN		2
+
+typedef struct
+{
+	int16_t a, b, c, d, e, f;
+} Bench_Args_t;
+
+typedef struct
+{
+	const char *Name;
+	void (*Run)(const Bench_Args_t *p);
+	void (*Gen)(Bench_Args_t *p, uint8_t Case, uint8_t i);
+} Bench_t;
+
+static const char *Bench_CaseName[] = {"random", "worst", "offscreen"};
+static Bench_Args_t Bench_Args[BENCH_ARGS];
+
+/*固定种子的xorshift32，保证每次运行参数相同*/
+static uint32_t Bench_Seed;
+static int16_t Rand(int16_t Min, int16_t Max)
+{
+	Bench_Seed ^= Bench_Seed << 13;
+	Bench_Seed ^= Bench_Seed >> 17;
+	Bench_Seed ^= Bench_Seed << 5;
+	return Min + (int16_t)(Bench_Seed % (uint32_t)(Max - Min + 1));
+}
+
+/*屏幕外坐标：随机落在屏幕左上方或右下方*/
+static int16_t RandOff(int16_t Size)
+{
+	return (Bench_Seed & 1) ? Rand(-400, -Size - 40) : Rand(Size + 40, 400);
+}
+
+static char *Bench_Strings[] = {"Hello", "OLED bench 0123", "~!@#$%^&*()_+{}|", "A"};
+
+/*被测函数*********************/
+
+static void Run_Line(const Bench_Args_t *p)		{OLED_DrawLine(p->a, p->b, p->c, p->d);}
+static void Run_Circle(const Bench_Args_t *p)	{OLED_DrawCircle(p->a, p->b, p->c, p->d);}
+static void Run_Arc(const Bench_Args_t *p)		{OLED_DrawArc(p->a, p->b, p->c, p->d, p->e, p->f);}
+static void Run_Triangle(const Bench_Args_t *p)	{OLED_DrawTriangle(p->a, p->b, p->c, p->d, p->e, p->f, OLED_FILLED);}
+static void Run_String(const Bench_Args_t *p)	{OLED_ShowString(p->a, p->b, Bench_Strings[p->c], p->d);}
+static void Run_VString(const Bench_Args_t *p)	{OLED_ShowString(p->a, p->b, Bench_Strings[p->c], p->d | OLED_VERTICAL);}
+static void Run_Num(const Bench_Args_t *p)		{OLED_ShowNum(p->a, p->b, (uint32_t)p->c * 65537U, p->e, p->d);}
+static void Run_Printf(const Bench_Args_t *p)	{OLED_Printf(p->a, p->b, p->d, "%d:%s %.2f", p->c, Bench_Strings[p->e % 4], p->c / 7.0);}
+
+/*参考负载：与 OLED 代码无关的缓冲区读改写，只用来换算机器速度*/
+static uint8_t Bench_RefBuf[8][128];
+static void Run_Reference(const Bench_Args_t *p)
+{
+	uint8_t i;
+	for (i = 0; i < 128; i ++)
+	{
+		Bench_RefBuf[(p->a + i) & 7][(p->b + i) & 127] ^= (uint8_t)(p->c >> (i & 7));
+	}
+}
+
+/*参数生成*********************/
+
+static void Gen_Reference(Bench_Args_t *p, uint8_t Case, uint8_t i)
+{
+	(void)Case; (void)i;
+	p->a = Rand(0, 7); p->b = Rand(0, 127); p->c = Rand(0, 32767);
+}
+
+static void Gen_Line(Bench_Args_t *p, uint8_t Case, uint8_t i)
+{
+	if (Case == BENCH_RANDOM)	{p->a = Rand(-32, 159); p->b = Rand(-32, 95); p->c = Rand(-32, 159); p->d = Rand(-32, 95);}
+	if (Case == BENCH_WORST)	{p->a = 0; p->b = i & 1 ? 0 : 63; p->c = 127; p->d = i & 1 ? 63 : 0;}
+	if (Case == BENCH_OFFSCREEN){p->a = RandOff(128); p->b = RandOff(64); p->c = p->a + Rand(-30, 30); p->d = p->b + Rand(-30, 30);}
+}
+
+static void Gen_Circle(Bench_Args_t *p, uint8_t Case, uint8_t i)
+{
+	if (Case == BENCH_RANDOM)	{p->a = Rand(-32, 159); p->b = Rand(-32, 95); p->c = Rand(1, 40); p->d = i & 1;}
+	if (Case == BENCH_WORST)	{p->a = 64; p->b = 32; p->c = 63; p->d = OLED_FILLED;}
+	if (Case == BENCH_OFFSCREEN){p->a = RandOff(128); p->b = RandOff(64); p->c = Rand(1, 30); p->d = i & 1;}
+}
+
+static void Gen_Arc(Bench_Args_t *p, uint8_t Case, uint8_t i)
+{
+	if (Case == BENCH_RANDOM)	{p->a = Rand(-32, 159); p->b = Rand(-32, 95); p->c = Rand(1, 40); p->d = Rand(-180, 180); p->e = Rand(-180, 180); p->f = i & 1;}
+	if (Case == BENCH_WORST)	{p->a = 64; p->b = 32; p->c = 63; p->d = -180; p->e = 179; p->f = OLED_FILLED;}
+	if (Case == BENCH_OFFSCREEN){p->a = RandOff(128); p->b = RandOff(64); p->c = Rand(1, 30); p->d = Rand(-180, 180); p->e = Rand(-180, 180); p->f = i & 1;}
+}
+
+static void Gen_Triangle(Bench_Args_t *p, uint8_t Case, uint8_t i)
+{
+	if (Case == BENCH_RANDOM)	{p->a = Rand(-32, 159); p->b = Rand(-32, 95); p->c = Rand(-32, 159); p->d = Rand(-32, 95); p->e = Rand(-32, 159); p->f = Rand(-32, 95);}
+	if (Case == BENCH_WORST)	{p->a = 0; p->b = 0; p->c = 127; p->d = i & 1 ? 0 : 63; p->e = 0; p->f = 63;}
+	if (Case == BENCH_OFFSCREEN){p->a = RandOff(128); p->b = RandOff(64); p->c = p->a + Rand(-30, 30); p->d = p->b + Rand(-30, 30); p->e = p->a + Rand(-30, 30); p->f = p->b + Rand(-30, 30);}
+}
+
+static void Gen_Text(Bench_Args_t *p, uint8_t Case, uint8_t i)
+{
+	p->c = Rand(0, 3);
+	p->e = Rand(1, 10);
+	p->d = i & 1 ? OLED_8X16 : OLED_6X8;
+	if (Case == BENCH_RANDOM)	{p->a = Rand(-64, 159); p->b = Rand(-32, 95);}
+	if (Case == BENCH_WORST)	{p->a = 0; p->b = 0; p->c = 2; p->e = 10; p->d = OLED_8X16;}
+	if (Case == BENCH_OFFSCREEN){p->a = RandOff(128); p->b = RandOff(64);}
+}
+
+static const Bench_t Benches[] = {
+	{"OLED_DrawLine",		Run_Line,		Gen_Line},
+	{"OLED_DrawCircle",		Run_Circle,		Gen_Circle},
+	{"OLED_DrawArc",		Run_Arc,		Gen_Arc},
+	{"OLED_DrawTriangle",	Run_Triangle,	Gen_Triangle},
+	{"OLED_ShowString",		Run_String,		Gen_Text},
+	{"OLED_ShowString_V",	Run_VString,	Gen_Text},
+	{"OLED_ShowNum",		Run_Num,		Gen_Text},
+	{"OLED_Printf",			Run_Printf,		Gen_Text},
+};
+
+static const Bench_t Bench_Reference = {"reference", Run_Reference, Gen_Reference};
+
+#define BENCH_COUNT			(sizeof(Benches) / sizeof(Benches[0]))
+
+/*测量一组参数的每次调用耗时*/
+static uint32_t Bench_Measure(const Bench_t *b, uint8_t Case)
+{
+	uint32_t Start, Time, Best = 0xFFFFFFFF;
+	uint16_t r, i, k;
+
+	Bench_Seed = 0x12345678 + Case;
+	for (i = 0; i < BENCH_ARGS; i ++)
+	{
+		memset(&Bench_Args[i], 0, sizeof(Bench_Args_t));
+		b->Gen(&Bench_Args[i], Case, i);
+	}
+
+	for (r = 0; r < BENCH_RUNS; r ++)
+	{
+		OLED_Clear();
+		Start = Bench_Now();
+		for (k = 0; k < BENCH_REPEAT; k ++)
+		{
+			for (i = 0; i < BENCH_ARGS; i ++)
+			{
+				b->Run(&Bench_Args[i]);
+			}
+		}
+		Time = Bench_Now() - Start;
+		if (Time < Best) {Best = Time;}
+	}
+	return Best / (BENCH_ARGS * BENCH_REPEAT);
+}
+
+#ifdef OLED_HOST_SIM
+
+/*从CSV基准文件中查找 name,case 对应的 rel，找不到返回0*/
+static uint32_t Bench_LoadBaseline(FILE *f, const char *Name, const char *Case)
+{
+	char Line[128], N[64], C[32];
+	unsigned int Value;
+
+	if (f == 0) {return 0;}
+	rewind(f);
+	while (fgets(Line, sizeof(Line), f))
+	{
+		if (sscanf(Line, "%63[^,],%31[^,],%*[^,],%u", N, C, &Value) == 3 &&
+		    strcmp(N, Name) == 0 && strcmp(C, Case) == 0)
+		{
+			return Value;
+		}
+	}
+	return 0;
+}
+
+#endif
+
+int main(int argc, char *argv[])
+{
+	uint32_t PerOp, Ref, Rel, Base = 0;
+	uint8_t n, c, Fail = 0, Skip = 0;
+	const char *Status = "-";
+#ifdef OLED_HOST_SIM
+	FILE *BaseFile = 0, *Out = 0;
+	const char *BaseName = argc > 1 ? argv[1] : BENCH_BASELINE;
+
+	if (argc > 2 && strcmp(argv[1], "-w") == 0) {Out = fopen(argv[2], "w");}
+	else if ((BaseFile = fopen(BaseName, "r")) == 0)
+	{
+		fprintf(stderr, "cannot open baseline %s, all cases will be skipped\n", BaseName);
+	}
+#else
+	(void)argc; (void)argv;
+	OLED_Init();
+	MyDWT_Init();
+#endif
+
+	printf("name,case,unit,per_op,rel,baseline,status\n");
+	for (n = 0; n < BENCH_COUNT; n ++)
+	{
+		for (c = 0; c < 3; c ++)
+		{
+			/*紧挨着测参考负载，使两者处于相同的主频和缓存状态*/
+			Ref = Bench_Measure(&Bench_Reference, c);
+			if (Ref == 0) {Ref = 1;}
+			PerOp = Bench_Measure(&Benches[n], c);
+			Rel = (uint32_t)((uint64_t)PerOp * 1000 / Ref);
+#ifdef OLED_HOST_SIM
+			Base = Bench_LoadBaseline(BaseFile, Benches[n].Name, Bench_CaseName[c]);
+			if (Out) {fprintf(Out, "%s,%s,rel,%u\n", Benches[n].Name, Bench_CaseName[c], (unsigned int)Rel);}
+			if (Base == 0)
+			{
+				Status = "SKIP";
+				Skip ++;
+			}
+			else if (Rel * 100 > Base * (100 + BENCH_TOLERANCE) + BENCH_SLACK * 100)
+			{
+				Status = "FAIL";
+				Fail ++;
+			}
+			else
+			{
+				Status = "OK";
+			}
+#endif
+			printf("%s,%s,%s,%u,%u,%u,%s\n", Benches[n].Name, Bench_CaseName[c], BENCH_UNIT,
+			       (unsigned int)PerOp, (unsigned int)Rel, (unsigned int)Base, Status);
+		}
+	}
+
+#ifdef OLED_HOST_SIM
+	if (Out)
+	{
+		fclose(Out);
+		return 0;
+	}
+	if (BaseFile) {fclose(BaseFile);}
+	printf("# fail:%d skip:%d\n", Fail, Skip);
+	return Fail ? 1 : (Skip ? 2 : 0);
+#else
+	(void)Fail; (void)Skip;
+	OLED_Clear();
+	OLED_ShowString(0, 0, "Bench done", OLED_8X16);
+	OLED_Update();
+	while (1);
+#endif
+}
@@ -0,0 +1,58 @@
+#include "stm32f10x.h"                  // Device header
+#include "Delay.h"
+#include "OLED.h"
+#include "OLED_Sched.h"
+#include "Key_Full.h"
+
+
+/*OLED_Panel test*/
+/*两块屏幕挂在同一总线上，地址分别为0x78和0x7A（第二块屏幕背面的地址电阻改焊）*/
+
+uint8_t Panel2Buf[OLED_PAGES][OLED_WIDTH];
+OLED_Panel_t Panel2;
+
+int main(void)
+{
+	uint16_t Count = 0;
+
+	OLED_Init();								//默认屏幕，地址0x78
+	OLED_PanelInit(&Panel2, Panel2Buf, 0x7A, OLED_ROTATE_0, 0);	//第二块屏幕，默认I2C
+
+	Key_Init();			// 借用 Key_Init 配置的 TIM1 1ms 中断作为帧节拍
+	OLED_Sched_Init(20);
+
+	OLED_Select(&OLED_DefaultPanel);
+	OLED_ShowString(0, 0, "Panel 0x78", OLED_8X16);
+	OLED_Sched_Request();
+
+	OLED_Select(&Panel2);
+	OLED_ShowString(0, 0, "Panel 0x7A", OLED_8X16);
+	OLED_Sched_Request();
+
+	while(1)
+	{
+		Count ++;
+
+		OLED_Select(&OLED_DefaultPanel);
+		OLED_ShowNum(0, 32, Count, 5, OLED_8X16);
+		OLED_Sched_RequestArea(0, 32, 40, 16);
+
+		OLED_Select(&Panel2);
+		OLED_DrawRectangle(0, 32, 128, 8, OLED_UNFILLED);
+		OLED_ClearArea(1, 33, 126, 6);
+		OLED_DrawRectangle(1, 33, Count % 127, 6, OLED_FILLED);
+		OLED_Sched_RequestArea(0, 32, 128, 8);
+
+		/*两块屏幕的脏区间按页交替发送*/
+		OLED_Sched_Process();
+		Delay_ms(10);
+	}
+}
+
+
+void TIM1_UP_IRQHandler(void){
+	if(TIM_GetITStatus(TIM1, TIM_IT_Update) == SET){
+		OLED_Sched_Tick();
+		TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+	}
+}
@@ -0,0 +1,47 @@
+#include "stm32f10x.h"                  // Device header
+#include "Delay.h"
+#include "GPIO_Init.h"
+#include "OLED.h"
+#include "OLED_Sched.h"
+#include "Key_Full.h"
+#include "MyRTC.h"
+
+
+/*OLED_Sched test*/
+int main(void)
+{
+	OLED_Sched_Stats_t Stats;
+	uint32_t Now, Last = 0xFFFFFFFF;
+	
+	OLED_Init();
+	MyRTC_Init();
+	Key_Init();			// 借用 Key_Init 配置的 TIM1 1ms 中断作为帧节拍
+	OLED_Sched_Init(20);
+	
+	while(1)
+	{
+		/*画面每秒才变化一次，其余帧时隙没有刷新请求，会被跳过*/
+		Now = RTC_GetCounter();
+		if(Now != Last)
+		{
+			Last = Now;
+			OLED_ShowNum(0, 0, Now, 5, OLED_8X16);
+			OLED_Sched_RequestArea(0, 0, 40, 16);
+			
+			OLED_Sched_GetStats(&Stats);
+			OLED_Printf(0, 32, OLED_6X8, "FPS:%3d DROP:%lu", Stats.Fps, Stats.Dropped);
+			OLED_Printf(0, 40, OLED_6X8, "SKIP:%lu", Stats.Skipped);
+			OLED_Sched_RequestArea(0, 32, 128, 16);
+		}
+		
+		OLED_Sched_Process();
+	}
+}
+
+
+void TIM1_UP_IRQHandler(void){
+	if(TIM_GetITStatus(TIM1, TIM_IT_Update) == SET){
+		OLED_Sched_Tick();
+		TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+	}
+}
@@ -0,0 +1,378 @@
+/**
+ * OLED_Sim test（PC 上运行的金样回归测试）
+ *
+ * 编译运行（在仓库根目录）：
+ *   gcc -DOLED_HOST_SIM -IOLED_SPI2IIC Test/OLED_Sim.c OLED_SPI2IIC/OLED.c \
+ *       OLED_SPI2IIC/OLED_Data.c OLED_SPI2IIC/OLED_Sim.c -lm -o oled_sim
+ *   ./oled_sim            只比对哈希
+ *   ./oled_sim out        同时把每个用例的快照保存为 out/<用例名>.pbm
+ *   ./oled_sim -u         打印各用例的新哈希（修改渲染代码并确认快照正确后，填入金样表）
+ * 加 -DOLED_STATS 编译时，额外检查OLED传输统计与模拟器统计的总线数据一致。
+ *
+ * 每个用例：清屏 -> 绘制 -> OLED_Update() -> 检查模拟 GDDRAM 与显存一致
+ * -> 计算显示内容哈希并与金样比对，同时打印本次更新的总线字节数与事务数。
+ * 金样基于默认配置（128x64，SSD1306）生成。
+ * 之后检查各屏幕方向下，逻辑坐标 (x, y) 的点出现在屏幕上预期的物理位置，
+ * 以及裁剪区域内的像素与只设原点时一致、区域外的像素保持不变，
+ * 竖排文字与横排文字逐点比较旋转关系。
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "OLED.h"
+#include "OLED_Sim.h"
+
+typedef struct
+{
+	const char *Name;
+	void (*Draw)(void);
+	uint32_t Golden;
+} TestCase_t;
+
+static void T_Char8x16(void)	{OLED_ShowChar(0, 0, 'A', OLED_8X16); OLED_ShowChar(120, 48, 'z', OLED_8X16);}
+static void T_Char6x8(void)		{OLED_ShowChar(0, 0, 'A', OLED_6X8); OLED_ShowChar(122, 56, 'z', OLED_6X8);}
+static void T_String(void)		{OLED_ShowString(0, 0, "Hello, OLED!", OLED_8X16); OLED_ShowString(3, 21, "0123456789~!@#$%", OLED_6X8);}
+static void T_Chinese(void)		{OLED_ShowString(0, 0, "你好，世界。", OLED_8X16); OLED_ShowString(0, 40, "A你B好", OLED_6X8);}
+static void T_Num(void)			{OLED_ShowNum(0, 0, 1234567890, 10, OLED_8X16); OLED_ShowSignedNum(0, 16, -4321, 5, OLED_8X16);}
+static void T_HexBin(void)		{OLED_ShowHexNum(0, 0, 0xBEEF, 4, OLED_8X16); OLED_ShowBinNum(0, 16, 0xA5, 8, OLED_6X8);}
+static void T_Float(void)		{OLED_ShowFloatNum(0, 0, -3.14159, 2, 4, OLED_8X16); OLED_ShowFloatNum(0, 32, 12.5, 3, 1, OLED_6X8);}
+static void T_Printf(void)		{OLED_Printf(5, 9, OLED_6X8, "x=%d y=%s", 42, "ok");}
+static void T_Image(void)		{OLED_ShowImage(0, 0, 16, 16, Diode); OLED_ShowImage(100, 53, 16, 16, Diode); OLED_ShowImage(-5, -3, 16, 16, Diode);}
+static void T_PString(void)		{OLED_ShowPString(0, 0, "Wavy AVA iiii", &OLED_PF8x16); OLED_ShowPString(0, 20, "Proportional 6x8", &OLED_PF6x8); OLED_ShowPString(0, 30, "Tab Yo.", &OLED_PF6x8); OLED_ShowPString(0, 40, "Tea Vo", &OLED_PF8x16);}
+static void T_Point(void)		{OLED_DrawPoint(0, 0); OLED_DrawPoint(127, 63); OLED_DrawPoint(64, 32); OLED_DrawPoint(-1, 5);}
+static void T_Line(void)		{OLED_DrawLine(0, 0, 127, 63); OLED_DrawLine(0, 63, 127, 0); OLED_DrawLine(10, 5, 10, 50); OLED_DrawLine(3, 30, 120, 30); OLED_DrawLine(20, 10, 40, 60);}
+static void T_Rect(void)		{OLED_DrawRectangle(2, 3, 50, 30, OLED_UNFILLED); OLED_DrawRectangle(60, 10, 40, 40, OLED_FILLED);}
+static void T_Triangle(void)	{OLED_DrawTriangle(5, 60, 30, 2, 60, 50, OLED_UNFILLED); OLED_DrawTriangle(70, 60, 95, 2, 125, 50, OLED_FILLED);}
+static void T_Circle(void)		{OLED_DrawCircle(30, 32, 25, OLED_UNFILLED); OLED_DrawCircle(95, 32, 20, OLED_FILLED);}
+static void T_Ellipse(void)		{OLED_DrawEllipse(32, 32, 30, 15, OLED_UNFILLED); OLED_DrawEllipse(96, 32, 20, 30, OLED_FILLED);}
+static void T_Arc(void)			{OLED_DrawArc(32, 32, 28, -30, 120, OLED_UNFILLED); OLED_DrawArc(96, 32, 28, 45, -135, OLED_FILLED);}
+static void T_Reverse(void)		{OLED_ShowString(0, 0, "Reverse", OLED_8X16); OLED_Reverse(); OLED_ReverseArea(10, 20, 50, 20);}
+static void T_ClearArea(void)	{OLED_DrawRectangle(0, 0, 128, 64, OLED_FILLED); OLED_ClearArea(20, 13, 60, 30); OLED_ClearArea(-10, -10, 15, 15);}
+
+/*金样表，用 ./oled_sim -u 重新生成*/
+static TestCase_t Tests[] = {
+	{"char_8x16",	T_Char8x16,	0x580F742A},
+	{"char_6x8",	T_Char6x8,	0x57573D4A},
+	{"string",		T_String,	0x1EEAADB9},
+	{"chinese",		T_Chinese,	0x59796059},
+	{"num",			T_Num,		0x2FBE6F8E},
+	{"hex_bin",		T_HexBin,	0xE609AE57},
+	{"float",		T_Float,	0x95ACFA42},
+	{"printf",		T_Printf,	0xF1D0BF70},
+	{"image",		T_Image,	0x5FAF6BBE},
+	{"pstring",		T_PString,	0xE441071C},
+	{"point",		T_Point,	0x7DFD7332},
+	{"line",		T_Line,		0xE9C449EF},
+	{"rectangle",	T_Rect,		0x3A784991},
+	{"triangle",	T_Triangle,	0x6BB69F80},
+	{"circle",		T_Circle,	0xBBCADC8E},
+	{"ellipse",		T_Ellipse,	0x3599D6FC},
+	{"arc",			T_Arc,		0xB30E078C},
+	{"reverse",		T_Reverse,	0xE38F7785},
+	{"clear_area",	T_ClearArea,	0x4FA20A40},
+};
+
+/*检查模拟GDDRAM与显存数组完全一致，即字节流被正确解码*/
+static int CheckRAM(void)
+{
+	uint8_t j;
+	for (j = 0; j < OLED_PAGES; j ++)
+	{
+		if (memcmp(OLED_Sim_GetRAM(0x78, j), OLED_DisplayBuf[j], OLED_WIDTH) != 0) {return 0;}
+	}
+	return 1;
+}
+
+/*屏幕方向用例：逻辑坐标到屏幕物理坐标的预期映射*/
+typedef struct
+{
+	const char *Name;
+	uint8_t Orientation;
+} Orient_t;
+
+static const Orient_t Orients[] = {
+	{"rotate_0",	OLED_ROTATE_0},
+	{"mirror_x",	OLED_MIRROR_X},
+	{"mirror_y",	OLED_MIRROR_Y},
+	{"rotate_180",	OLED_ROTATE_180},
+	{"rotate_90",	OLED_ROTATE_90},
+	{"rotate_270",	OLED_ROTATE_270},
+};
+
+static void OrientMap(uint8_t Orientation, int16_t x, int16_t y, int16_t *px, int16_t *py)
+{
+	switch (Orientation)
+	{
+		case OLED_MIRROR_X:		*px = OLED_WIDTH - 1 - x;	*py = y;					break;
+		case OLED_MIRROR_Y:		*px = x;					*py = OLED_HEIGHT - 1 - y;	break;
+		case OLED_ROTATE_180:	*px = OLED_WIDTH - 1 - x;	*py = OLED_HEIGHT - 1 - y;	break;
+		case OLED_ROTATE_90:	*px = OLED_WIDTH - 1 - y;	*py = x;					break;
+		case OLED_ROTATE_270:	*px = y;					*py = OLED_HEIGHT - 1 - x;	break;
+		default:				*px = x;					*py = y;					break;
+	}
+}
+
+/*在指定方向下绘制文字、比例字体、图形和清除区域，逐点比较逻辑显存与屏幕显示*/
+static int CheckOrientation(uint8_t Orientation)
+{
+	int16_t x, y, px, py;
+
+	OLED_SetOrientation(Orientation);
+	OLED_Clear();
+	OLED_ShowString(0, 0, "Rot", OLED_8X16);
+	OLED_ShowPString(2, 20, "Ab", &OLED_PF6x8);
+	OLED_DrawLine(0, OLED_SCREEN_HEIGHT - 1, OLED_SCREEN_WIDTH - 1, 30);
+	OLED_DrawCircle(OLED_SCREEN_WIDTH / 2, OLED_SCREEN_HEIGHT / 2, 10, OLED_FILLED);
+	OLED_ClearArea(OLED_SCREEN_WIDTH / 2 - 3, OLED_SCREEN_HEIGHT / 2 - 5, 6, 10);
+	OLED_UpdateArea(0, 0, OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT);
+
+	for (y = 0; y < OLED_SCREEN_HEIGHT; y ++)
+	{
+		for (x = 0; x < OLED_SCREEN_WIDTH; x ++)
+		{
+			OrientMap(Orientation, x, y, &px, &py);
+			if (OLED_GetPoint(x, y) != OLED_Sim_GetPixel(0x78, px, py)) {return 0;}
+		}
+	}
+	return 1;
+}
+
+/*裁剪用例：在视口内以局部坐标绘制，图形均部分超出视口*/
+static void ClipScene(void)
+{
+	OLED_ShowString(-5, -4, "Clip", OLED_8X16);
+	OLED_ShowPString(20, 14, "Wavy", &OLED_PF6x8);
+	OLED_DrawLine(-10, 3, 60, 40);
+	OLED_DrawRectangle(30, -6, 20, 15, OLED_UNFILLED);
+	OLED_DrawCircle(45, 20, 14, OLED_FILLED);
+	OLED_DrawTriangle(-8, 30, 25, 5, 50, 35, OLED_FILLED);
+	OLED_ReverseArea(2, 2, 12, 40);
+}
+
+/*读取显存数组中的一个像素*/
+static uint8_t BufPixel(uint8_t (*Buf)[OLED_WIDTH], int16_t X, int16_t Y)
+{
+	return (Buf[Y / 8][X] >> (Y % 8)) & 0x01;
+}
+
+static int CheckClip(void)
+{
+	static uint8_t Background[OLED_PAGES][OLED_WIDTH], Origin[OLED_PAGES][OLED_WIDTH];
+	const int16_t X = 37, Y = 11, W = 41, H = 27;
+	int16_t x, y;
+	uint8_t Expected;
+
+	/*背景为交错图案，便于发现裁剪区域外被改动的像素*/
+	for (y = 0; y < OLED_PAGES; y ++)
+	{
+		for (x = 0; x < OLED_WIDTH; x ++) {OLED_DisplayBuf[y][x] = (x & 1) ? 0xA5 : 0x3C;}
+	}
+	memcpy(Background, OLED_DisplayBuf, sizeof(Background));
+
+	/*只设原点*/
+	OLED_PushView();
+	OLED_SetOrigin(X, Y);
+	ClipScene();
+	OLED_PopView();
+	memcpy(Origin, OLED_DisplayBuf, sizeof(Origin));
+
+	/*原点与裁剪区域*/
+	memcpy(OLED_DisplayBuf, Background, sizeof(Background));
+	OLED_PushViewport(X, Y, W, H);
+	ClipScene();
+	OLED_PopView();
+
+	for (y = 0; y < OLED_HEIGHT; y ++)
+	{
+		for (x = 0; x < OLED_WIDTH; x ++)
+		{
+			if (x >= X && x < X + W && y >= Y && y < Y + H) {Expected = BufPixel(Origin, x, y);}
+			else {Expected = BufPixel(Background, x, y);}
+			if (BufPixel(OLED_DisplayBuf, x, y) != Expected) {return 0;}
+		}
+	}
+	return 1;
+}
+
+/*竖排用例：横排显示后逐点记下，再竖排显示，检查每个点旋转90度后的位置*/
+/*W、H为横排时整个字符串的宽高，First为第一个字符的宽度（向上排列时第一个字符的底边在Y + First - 1）*/
+static int CheckVerticalOne(char *String, uint8_t FontSize, uint8_t Vertical, uint8_t W, uint8_t H, uint8_t First)
+{
+	static uint8_t Horizontal[16][40];
+	const int16_t X = 40, Y = 24;
+	int16_t x, y, vx, vy;
+
+	OLED_Clear();
+	OLED_ShowString(0, 0, String, FontSize);
+	for (y = 0; y < H; y ++)
+	{
+		for (x = 0; x < W; x ++) {Horizontal[y][x] = OLED_GetPoint(x, y);}
+	}
+
+	OLED_Clear();
+	OLED_ShowString(X, Y, String, FontSize | Vertical);
+	for (y = 0; y < H; y ++)
+	{
+		for (x = 0; x < W; x ++)
+		{
+			/*顺时针：(x, y) -> (H - 1 - y, x)；逆时针：(x, y) -> (y, First - 1 - x)*/
+			vx = Vertical == OLED_VERTICAL ? X + H - 1 - y : X + y;
+			vy = Vertical == OLED_VERTICAL ? Y + x : Y + First - 1 - x;
+			if (OLED_GetPoint(vx, vy) != Horizontal[y][x]) {return 0;}
+		}
+	}
+	return 1;
+}
+
+static int CheckVertical(void)
+{
+	char String[2] = {0, 0};
+	uint8_t v;
+	static const uint8_t Vertical[] = {OLED_VERTICAL, OLED_VERTICAL_UP};
+	static uint8_t Chars[OLED_PAGES][OLED_WIDTH];
+
+	for (v = 0; v < 2; v ++)
+	{
+		for (String[0] = ' '; String[0] <= '~'; String[0] ++)
+		{
+			if (!CheckVerticalOne(String, OLED_6X8, Vertical[v], 6, 8, 6)) {return 0;}
+			if (!CheckVerticalOne(String, OLED_8X16, Vertical[v], 8, 16, 8)) {return 0;}
+		}
+		if (!CheckVerticalOne("你", OLED_8X16, Vertical[v], 16, 16, 16)) {return 0;}
+		
+		/*ASCII与汉字混排，字符高度不同时不能互相覆盖*/
+		if (!CheckVerticalOne("A你B", OLED_8X16, Vertical[v], 32, 16, 8)) {return 0;}
+		if (!CheckVerticalOne("你A好", OLED_8X16, Vertical[v], 40, 16, 16)) {return 0;}
+	}
+
+	/*字符沿Y轴排列：向下时第二个字符在下方，向上时在上方*/
+	for (v = 0; v < 2; v ++)
+	{
+		OLED_Clear();
+		OLED_ShowChar(40, 24, 'A', OLED_6X8 | Vertical[v]);
+		OLED_ShowChar(40, Vertical[v] == OLED_VERTICAL ? 30 : 18, 'B', OLED_6X8 | Vertical[v]);
+		memcpy(Chars, OLED_DisplayBuf, sizeof(Chars));
+		OLED_Clear();
+		OLED_ShowString(40, 24, "AB", OLED_6X8 | Vertical[v]);
+		if (memcmp(Chars, OLED_DisplayBuf, sizeof(Chars)) != 0) {return 0;}
+	}
+	return 1;
+}
+
+/*打印一次更新的总线开销*/
+static void PrintBus(const char *Name)
+{
+	OLED_Sim_Stats_t Stats;
+	OLED_Sim_GetStats(&Stats);
+	printf("  %-28s %5u bytes %3u transactions (%u cmd, %u data)\n",
+	       Name, Stats.Bytes, Stats.Transactions, Stats.Commands, Stats.Data);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *Dir = 0;
+	int Update = 0, Fail = 0;
+	unsigned int i;
+	uint32_t Hash;
+	char Path[256];
+	OLED_Sim_Stats_t Stats;
+
+	if (argc > 1 && strcmp(argv[1], "-u") == 0) {Update = 1;}
+	else if (argc > 1) {Dir = argv[1];}
+
+	OLED_Sim_Reset();
+	OLED_Init();
+
+	for (i = 0; i < sizeof(Tests) / sizeof(Tests[0]); i ++)
+	{
+		OLED_Clear();
+		Tests[i].Draw();
+		OLED_Sim_ResetStats();
+		OLED_Update();
+		OLED_Sim_GetStats(&Stats);
+
+		Hash = OLED_Sim_Hash(0x78);
+		if (Update)
+		{
+			printf("%-12s 0x%08X\n", Tests[i].Name, (unsigned int)Hash);
+			continue;
+		}
+		if (Dir)
+		{
+			snprintf(Path, sizeof(Path), "%s/%s.pbm", Dir, Tests[i].Name);
+			OLED_Sim_SavePBM(0x78, Path);
+		}
+
+		if (!CheckRAM() || Hash != Tests[i].Golden)
+		{
+			Fail ++;
+			printf("FAIL %-12s hash 0x%08X expected 0x%08X%s\n", Tests[i].Name, (unsigned int)Hash,
+			       (unsigned int)Tests[i].Golden, CheckRAM() ? "" : " (GDDRAM mismatch)");
+		}
+		else
+		{
+			printf("PASS %-12s hash 0x%08X %5u bytes %3u transactions\n", Tests[i].Name,
+			       (unsigned int)Hash, Stats.Bytes, Stats.Transactions);
+		}
+	}
+	if (Update) {return 0;}
+
+	for (i = 0; i < sizeof(Orients) / sizeof(Orients[0]); i ++)
+	{
+		if (CheckOrientation(Orients[i].Orientation))
+		{
+			printf("PASS %-12s\n", Orients[i].Name);
+		}
+		else
+		{
+			Fail ++;
+			printf("FAIL %-12s logical pixels do not match the panel\n", Orients[i].Name);
+		}
+	}
+	OLED_SetOrientation(OLED_ROTATE_0);
+	OLED_Clear();
+	OLED_Update();
+
+	if (CheckClip()) {printf("PASS clip\n");}
+	else {Fail ++; printf("FAIL clip         pixels outside the clip changed or inside differ\n");}
+
+	if (CheckVertical()) {printf("PASS vertical\n");}
+	else {Fail ++; printf("FAIL vertical     rotated glyphs do not match the horizontal ones\n");}
+
+	/*传输开销基准：优化传输层后对比这些数字*/
+	printf("\nbus cost:\n");
+	OLED_Sim_ResetStats(); OLED_Update();						PrintBus("OLED_Update");
+	OLED_Sim_ResetStats(); OLED_UpdateArea(0, 0, 128, 64);		PrintBus("OLED_UpdateArea 128x64");
+	OLED_Sim_ResetStats(); OLED_UpdateArea(0, 0, 8, 16);		PrintBus("OLED_UpdateArea 8x16 @0,0");
+	OLED_Sim_ResetStats(); OLED_UpdateArea(10, 5, 30, 20);		PrintBus("OLED_UpdateArea 30x20 @10,5");
+	OLED_Sim_ResetStats(); OLED_UpdateArea(100, 60, 28, 4);		PrintBus("OLED_UpdateArea 28x4 @100,60");
+
+#ifdef OLED_STATS
+	/*OLED_STATS统计的事务与字节数应与模拟器在总线上看到的一致*/
+	{
+		OLED_Stats_t OStats;
+		OLED_ResetStats();
+		OLED_Sim_ResetStats();
+		OLED_Update();
+		OLED_UpdateArea(10, 5, 30, 20);
+		OLED_GetStats(&OStats);
+		OLED_Sim_GetStats(&Stats);
+		if (OStats.Transactions != Stats.Transactions || OStats.CommandBytes != Stats.Commands ||
+		    OStats.DataBytes != Stats.Data || OStats.Updates != 2)
+		{
+			Fail ++;
+			printf("FAIL stats       %u transactions %u cmd %u data, bus %u/%u/%u\n",
+			       (unsigned int)OStats.Transactions, (unsigned int)OStats.CommandBytes, (unsigned int)OStats.DataBytes,
+			       Stats.Transactions, Stats.Commands, Stats.Data);
+		}
+		else
+		{
+			printf("PASS stats       %u transactions %u cmd %u data\n", (unsigned int)OStats.Transactions,
+			       (unsigned int)OStats.CommandBytes, (unsigned int)OStats.DataBytes);
+		}
+	}
+#endif
+
+	printf("\n%d/%u failed\n", Fail, (unsigned int)(sizeof(Tests) / sizeof(Tests[0]) + sizeof(Orients) / sizeof(Orients[0]) + 2));
+	return Fail ? 1 : 0;
+}
@@ -0,0 +1,45 @@
+#include "stm32f10x.h"                  // Device header
+#include "Delay.h"
+#include "GPIO_Init.h"
+#include "OLED.h"
+#include "Timer.h"
+#include "UI.h"
+
+
+/*UI test*/
+const char * const Items[] = {"Speed", "Power", "Light", "About"};
+
+volatile int32_t Count = 0;
+int main(void)
+{
+	UI_Widget_t *Label, *Number, *Bar, *Gauge, *List;
+	
+	OLED_Init();
+	Timer_Init();
+	UI_Init();
+	
+	Label  = UI_CreateLabel(0, 0, 48, "Time", OLED_6X8);
+	Number = UI_CreateNumber(48, 0, 0, 5, OLED_6X8);
+	Bar    = UI_CreateBar(0, 10, 80, 8, 0, 59);
+	Gauge  = UI_CreateGauge(0, 30, 20, 0, 59);
+	UI_CreateIcon(100, 0, 16, 16, Diode);
+	List   = UI_CreateList(64, 24, 64, 32, Items, 4, OLED_6X8);
+	
+	while(1)
+	{
+		/*数值不变时以下调用不会触发重绘，UI_Render直接返回*/
+		UI_SetText(Label, Count % 2 ? "Tick" : "Tock");
+		UI_SetValue(Number, Count);
+		UI_SetValue(Bar, Count % 60);
+		UI_SetValue(Gauge, Count % 60);
+		UI_SetSelected(List, Count % 4);
+		UI_Render();
+	}
+}
+
+void TIM2_IRQHandler(void){
+	if(TIM_GetITStatus(TIM2, TIM_IT_Update) == SET){
+		Count ++;
+		TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+	}
+}
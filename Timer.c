@@ -16,6 +16,7 @@
  */
 
 #include "stm32f10x.h"  ///< STM32 标准外设库头文件
+#include "IrqLatency.h"
 
 /**
  * @brief  初始化 TIM2 为定时中断模式
@@ -75,6 +76,7 @@ void Timer_Init(void)
  */
 void TIM2_IRQHandler(void)
 {
+    IRQ_LATENCY_ENTER(IRQLAT_TIM2);
     if (TIM_GetITStatus(TIM2, TIM_IT_Update) == SET)
     {
         /*-------------------- 用户代码区 --------------------*/
@@ -85,4 +87,5 @@ void TIM2_IRQHandler(void)
         /* 清除中断标志位，防止重复进入 */
         TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
     }
+    IRQ_LATENCY_EXIT(IRQLAT_TIM2);
 }
@@ -0,0 +1,428 @@
+/**
+ ******************************************************************************
+ * @file    UI.c
+ * @brief   OLED 保留模式控件库：标签、数值、进度条、仪表盘、图标、列表
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * 与直接调用 OLED_xxx 每帧重画整屏不同，本模块中每个控件保存自身状态与包围盒：
+ * - 控件从静态控件池 UI_Pool 分配，无需堆内存；
+ * - UI_SetXxx() 仅在数值真正变化时才把控件标记为失效；
+ * - UI_Render() 只清除并重绘失效控件，再只把它们的包围盒刷新到屏幕，
+ *   没有控件失效时不访问总线。
+ *
+ * 控件按创建顺序绘制，后创建的在上层；
+ * 失效控件的包围盒与其他控件重叠时，被覆盖的控件会一并重绘。
+ *
+ * 使用示例：
+ * @code
+ * UI_Widget_t *Bar;
+ * UI_Init();
+ * Bar = UI_CreateBar(0, 48, 128, 10, 0, 100);
+ * while (1)
+ * {
+ *     UI_SetValue(Bar, Percent);
+ *     UI_Render();
+ * }
+ * @endcode
+ *
+ * 依赖：
+ * - OLED.h
+ * - UI.h
+ ******************************************************************************
+ */
+
+#include <string.h>
+#include <math.h>
+#include "OLED.h"
+#include "UI.h"
+
+/* 已删除、等待下次渲染时清除的控件类型 */
+#define UI_DELETED          0xFF
+
+/* 静态控件池 */
+static UI_Widget_t UI_Pool[UI_WIDGET_MAX];
+
+/**
+ * @brief  根据字体获取一行文字的高度
+ */
+static uint8_t UI_LineHeight(uint8_t FontSize){
+	return FontSize == OLED_8X16 ? 16 : 8;
+}
+
+/**
+ * @brief  从控件池分配一个控件并设置公共字段
+ * @retval 控件指针，控件池已满时返回 NULL
+ */
+static UI_Widget_t *UI_Alloc(uint8_t Type, int16_t X, int16_t Y, uint8_t Width, uint8_t Height){
+	uint8_t i;
+
+	for(i = 0; i < UI_WIDGET_MAX; i++){
+		if(!(UI_Pool[i].Flags & UI_FLAG_USED)){
+			memset(&UI_Pool[i], 0, sizeof(UI_Widget_t));
+			UI_Pool[i].Type = Type;
+			UI_Pool[i].Flags = UI_FLAG_USED | UI_FLAG_VISIBLE | UI_FLAG_INVALID;
+			UI_Pool[i].X = X;
+			UI_Pool[i].Y = Y;
+			UI_Pool[i].Width = Width;
+			UI_Pool[i].Height = Height;
+			return &UI_Pool[i];
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief  判断两个控件的包围盒是否重叠
+ */
+static uint8_t UI_Overlap(const UI_Widget_t *a, const UI_Widget_t *b){
+	return a->X < b->X + b->Width && b->X < a->X + a->Width &&
+	       a->Y < b->Y + b->Height && b->Y < a->Y + a->Height;
+}
+
+/**
+ * @brief  把控件的包围盒刷新到屏幕（裁剪到屏幕范围内）
+ */
+static void UI_Flush(const UI_Widget_t *w){
+	int16_t X = w->X, Width = w->Width;
+
+	if(X < 0){
+		Width += X;
+		X = 0;
+	}
+	if(X + Width > OLED_WIDTH){
+		Width = OLED_WIDTH - X;
+	}
+	if(Width > 0){
+		OLED_UpdateArea(X, w->Y, Width, w->Height);
+	}
+}
+
+/**
+ * @brief  在显存中绘制一个控件（调用前其包围盒已被清空）
+ */
+static void UI_Draw(UI_Widget_t *w){
+	uint8_t i, Row, Rows, LineHeight, Fill;
+	int16_t cx, cy;
+	float Angle;
+
+	switch(w->Type){
+		case UI_LABEL:
+			OLED_ShowString(w->X, w->Y, w->u.Text, w->FontSize);
+			break;
+
+		case UI_NUMBER:
+			OLED_Printf(w->X, w->Y, w->FontSize, "%*ld", w->u.Num.Length, (long)w->u.Num.Value);
+			break;
+
+		case UI_BAR:
+			OLED_DrawRectangle(w->X, w->Y, w->Width, w->Height, OLED_UNFILLED);
+			if(w->Width < 5 || w->Height < 5){
+				break;
+			}
+			Fill = (int64_t)(w->u.Num.Value - w->u.Num.Min) * (w->Width - 4) / (w->u.Num.Max - w->u.Num.Min);
+			OLED_DrawRectangle(w->X + 2, w->Y + 2, Fill, w->Height - 4, OLED_FILLED);
+			break;
+
+		case UI_GAUGE:
+			// 包围盒宽 2R+1、高 R+1，圆心在底边中点；指针从左（最小值）扫到右（最大值）
+			cx = w->X + w->Height - 1;
+			cy = w->Y + w->Height - 1;
+			OLED_DrawArc(cx, cy, w->Height - 1, -180, 0, OLED_UNFILLED);
+			Angle = 3.1415926f * (w->u.Num.Value - w->u.Num.Min) / (w->u.Num.Max - w->u.Num.Min);
+			OLED_DrawLine(cx, cy,
+			              cx - (int16_t)((w->Height - 3) * cosf(Angle)),
+			              cy - (int16_t)((w->Height - 3) * sinf(Angle)));
+			break;
+
+		case UI_ICON:
+			if(w->u.Image){
+				OLED_ShowImage(w->X, w->Y, w->Width, w->Height, w->u.Image);
+			}
+			break;
+
+		case UI_LIST:
+			LineHeight = UI_LineHeight(w->FontSize);
+			Rows = w->Height / LineHeight;
+			for(Row = 0; Row < Rows; Row++){
+				i = w->u.List.Top + Row;
+				if(i >= w->u.List.Count){
+					break;
+				}
+				OLED_ShowString(w->X + 1, w->Y + Row * LineHeight, (char *)w->u.List.Items[i], w->FontSize);
+				if(i == w->u.List.Selected){
+					OLED_ReverseArea(w->X, w->Y + Row * LineHeight, w->Width, LineHeight);
+				}
+			}
+			break;
+	}
+}
+
+/**
+ * @brief  初始化控件库，释放控件池中的所有控件
+ */
+void UI_Init(void){
+	memset(UI_Pool, 0, sizeof(UI_Pool));
+}
+
+/**
+ * @brief  创建文本标签
+ * @param  X, Y     左上角坐标
+ * @param  Width    标签宽度（像素），重绘时清除的区域
+ * @param  Text     初始文本，会被复制到控件内（最多 UI_TEXT_MAX - 1 字节）
+ * @param  FontSize 字体：OLED_8X16 / OLED_6X8
+ * @retval 控件指针，控件池已满时返回 NULL
+ */
+UI_Widget_t *UI_CreateLabel(int16_t X, int16_t Y, uint8_t Width, const char *Text, uint8_t FontSize){
+	UI_Widget_t *w = UI_Alloc(UI_LABEL, X, Y, Width, UI_LineHeight(FontSize));
+
+	if(w){
+		w->FontSize = FontSize;
+		strncpy(w->u.Text, Text, UI_TEXT_MAX - 1);
+	}
+	return w;
+}
+
+/**
+ * @brief  创建数值显示控件（右对齐十进制，负数带 '-'）
+ * @param  Length 显示宽度（字符数，含符号位）
+ */
+UI_Widget_t *UI_CreateNumber(int16_t X, int16_t Y, int32_t Value, uint8_t Length, uint8_t FontSize){
+	UI_Widget_t *w = UI_Alloc(UI_NUMBER, X, Y, Length * FontSize, UI_LineHeight(FontSize));
+
+	if(w){
+		w->FontSize = FontSize;
+		w->u.Num.Value = Value;
+		w->u.Num.Length = Length;
+	}
+	return w;
+}
+
+/**
+ * @brief  创建水平进度条
+ * @param  Min, Max 取值范围，初始值为 Min
+ */
+UI_Widget_t *UI_CreateBar(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, int32_t Min, int32_t Max){
+	UI_Widget_t *w = UI_Alloc(UI_BAR, X, Y, Width, Height);
+
+	if(w){
+		w->u.Num.Min = Min;
+		w->u.Num.Max = Max > Min ? Max : Min + 1;
+		w->u.Num.Value = Min;
+	}
+	return w;
+}
+
+/**
+ * @brief  创建半圆仪表盘
+ * @param  X, Y   包围盒左上角，包围盒为 (2 * Radius + 1) x (Radius + 1)
+ * @param  Radius 半径
+ * @param  Min, Max 取值范围，初始值为 Min
+ */
+UI_Widget_t *UI_CreateGauge(int16_t X, int16_t Y, uint8_t Radius, int32_t Min, int32_t Max){
+	UI_Widget_t *w = UI_Alloc(UI_GAUGE, X, Y, 2 * Radius + 1, Radius + 1);
+
+	if(w){
+		w->u.Num.Min = Min;
+		w->u.Num.Max = Max > Min ? Max : Min + 1;
+		w->u.Num.Value = Min;
+	}
+	return w;
+}
+
+/**
+ * @brief  创建图标
+ * @param  Image 图像数据（与 OLED_ShowImage 格式相同），可为 NULL
+ */
+UI_Widget_t *UI_CreateIcon(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image){
+	UI_Widget_t *w = UI_Alloc(UI_ICON, X, Y, Width, Height);
+
+	if(w){
+		w->u.Image = Image;
+	}
+	return w;
+}
+
+/**
+ * @brief  创建列表 / 菜单
+ * @param  Items 列表项文本数组（调用者保证其生命周期，通常为 const 表）
+ * @param  Count 列表项数量
+ * @note   可见行数为 Height / 行高，选中项反色显示并自动滚动到可见范围。
+ */
+UI_Widget_t *UI_CreateList(int16_t X, int16_t Y, uint8_t Width, uint8_t Height,
+                           const char * const *Items, uint8_t Count, uint8_t FontSize){
+	UI_Widget_t *w = UI_Alloc(UI_LIST, X, Y, Width, Height);
+
+	if(w){
+		w->FontSize = FontSize;
+		w->u.List.Items = Items;
+		w->u.List.Count = Count;
+	}
+	return w;
+}
+
+/**
+ * @brief  删除控件，归还控件池
+ * @note   控件所在区域会在下次 UI_Render() 时被清除。
+ */
+void UI_Delete(UI_Widget_t *Widget){
+	if(Widget){
+		Widget->Flags &= ~UI_FLAG_VISIBLE;
+		Widget->Flags |= UI_FLAG_INVALID;
+		Widget->Type = UI_DELETED;  // UI_Render() 清除其区域后归还控件池
+	}
+}
+
+/**
+ * @brief  设置标签文本，内容不变时不重绘
+ */
+void UI_SetText(UI_Widget_t *Widget, const char *Text){
+	if(Widget && Widget->Type == UI_LABEL && strncmp(Widget->u.Text, Text, UI_TEXT_MAX - 1) != 0){
+		strncpy(Widget->u.Text, Text, UI_TEXT_MAX - 1);
+		Widget->Flags |= UI_FLAG_INVALID;
+	}
+}
+
+/**
+ * @brief  设置数值 / 进度条 / 仪表盘的当前值，数值不变时不重绘
+ * @note   进度条和仪表盘的值会被限制在 [Min, Max] 内。
+ */
+void UI_SetValue(UI_Widget_t *Widget, int32_t Value){
+	if(Widget == 0){
+		return;
+	}
+	if(Widget->Type == UI_BAR || Widget->Type == UI_GAUGE){
+		if(Value < Widget->u.Num.Min) Value = Widget->u.Num.Min;
+		if(Value > Widget->u.Num.Max) Value = Widget->u.Num.Max;
+	}else if(Widget->Type != UI_NUMBER){
+		return;
+	}
+	if(Widget->u.Num.Value != Value){
+		Widget->u.Num.Value = Value;
+		Widget->Flags |= UI_FLAG_INVALID;
+	}
+}
+
+/**
+ * @brief  更换图标图像，图像不变时不重绘
+ */
+void UI_SetImage(UI_Widget_t *Widget, const uint8_t *Image){
+	if(Widget && Widget->Type == UI_ICON && Widget->u.Image != Image){
+		Widget->u.Image = Image;
+		Widget->Flags |= UI_FLAG_INVALID;
+	}
+}
+
+/**
+ * @brief  设置列表选中项，并在需要时滚动使其可见
+ */
+void UI_SetSelected(UI_Widget_t *Widget, uint8_t Index){
+	uint8_t Rows;
+
+	if(Widget == 0 || Widget->Type != UI_LIST || Index >= Widget->u.List.Count ||
+	   Widget->u.List.Selected == Index){
+		return;
+	}
+
+	Rows = Widget->Height / UI_LineHeight(Widget->FontSize);
+	if(Index < Widget->u.List.Top){
+		Widget->u.List.Top = Index;
+	}else if(Rows && Index >= Widget->u.List.Top + Rows){
+		Widget->u.List.Top = Index - Rows + 1;
+	}
+	Widget->u.List.Selected = Index;
+	Widget->Flags |= UI_FLAG_INVALID;
+}
+
+/**
+ * @brief  显示 / 隐藏控件，状态不变时不重绘
+ */
+void UI_SetVisible(UI_Widget_t *Widget, uint8_t Visible){
+	if(Widget == 0 || !(Widget->Flags & UI_FLAG_USED)){
+		return;
+	}
+	if(Visible && !(Widget->Flags & UI_FLAG_VISIBLE)){
+		Widget->Flags |= UI_FLAG_VISIBLE | UI_FLAG_INVALID;
+	}else if(!Visible && (Widget->Flags & UI_FLAG_VISIBLE)){
+		Widget->Flags &= ~UI_FLAG_VISIBLE;
+		Widget->Flags |= UI_FLAG_INVALID;
+	}
+}
+
+/**
+ * @brief  强制控件在下次 UI_Render() 时重绘
+ */
+void UI_Invalidate(UI_Widget_t *Widget){
+	if(Widget){
+		Widget->Flags |= UI_FLAG_INVALID;
+	}
+}
+
+/**
+ * @brief  渲染所有失效控件
+ * @retval 本次重绘的控件数量，0 表示没有访问总线
+ * @note
+ * - 与失效控件包围盒重叠的可见控件也会被重绘（可传递），避免被清除区域误伤；
+ * - 控件绘制时裁剪到自身包围盒，文字等超出包围盒的部分不显示；
+ * - 每个重绘的控件只刷新自己的包围盒所在的页与列。
+ */
+uint8_t UI_Render(void){
+	uint8_t i, j, Count = 0, Changed;
+	UI_Widget_t *w;
+
+	// 失效传播：被清除区域覆盖到的其他控件也需要重绘；
+	// 新失效的控件又会清除自己的包围盒，因此重复传播直到没有新的失效控件
+	do{
+		Changed = 0;
+		for(i = 0; i < UI_WIDGET_MAX; i++){
+			if((UI_Pool[i].Flags & (UI_FLAG_USED | UI_FLAG_INVALID)) != (UI_FLAG_USED | UI_FLAG_INVALID)){
+				continue;
+			}
+			for(j = 0; j < UI_WIDGET_MAX; j++){
+				if(j != i && (UI_Pool[j].Flags & (UI_FLAG_USED | UI_FLAG_VISIBLE | UI_FLAG_INVALID)) == (UI_FLAG_USED | UI_FLAG_VISIBLE) &&
+				   UI_Overlap(&UI_Pool[i], &UI_Pool[j])){
+					UI_Pool[j].Flags |= UI_FLAG_INVALID;
+					Changed = 1;
+				}
+			}
+		}
+	}while(Changed);
+
+	// 先清除全部失效区域，再按创建顺序绘制，保证层叠顺序正确
+	for(i = 0; i < UI_WIDGET_MAX; i++){
+		w = &UI_Pool[i];
+		if((w->Flags & (UI_FLAG_USED | UI_FLAG_INVALID)) == (UI_FLAG_USED | UI_FLAG_INVALID)){
+			OLED_ClearArea(w->X, w->Y, w->Width, w->Height);
+		}
+	}
+	for(i = 0; i < UI_WIDGET_MAX; i++){
+		w = &UI_Pool[i];
+		if((w->Flags & (UI_FLAG_USED | UI_FLAG_INVALID)) == (UI_FLAG_USED | UI_FLAG_INVALID) &&
+		   (w->Flags & UI_FLAG_VISIBLE)){
+			// 裁剪到包围盒：超出部分不会被清除与刷新，不能画出去
+			if(OLED_PushView()){
+				OLED_SetClip(w->X, w->Y, w->Width, w->Height);
+				UI_Draw(w);
+				OLED_PopView();
+			}else{
+				UI_Draw(w);             // 视图栈已满，不裁剪
+			}
+		}
+	}
+
+	// 只刷新失效控件的包围盒
+	for(i = 0; i < UI_WIDGET_MAX; i++){
+		w = &UI_Pool[i];
+		if((w->Flags & (UI_FLAG_USED | UI_FLAG_INVALID)) == (UI_FLAG_USED | UI_FLAG_INVALID)){
+			UI_Flush(w);
+			w->Flags &= ~UI_FLAG_INVALID;
+			if(w->Type == UI_DELETED){
+				w->Flags = 0;       // 已删除的控件在清除后归还控件池
+			}
+			Count++;
+		}
+	}
+	return Count;
+}
@@ -0,0 +1,101 @@
+/**
+ ******************************************************************************
+ * @file    UI.h
+ * @brief   OLED 保留模式控件库头文件
+ * @note    声明控件类型、控件池与控件创建/设置/渲染接口。
+ * @version 1.0
+ * @date    2025-10-18
+ * @author  Jeffrey
+ ******************************************************************************
+ * @attention
+ * - 本模块基于 OLED.h 的显存与绘图函数，控件全部来自静态控件池，不使用堆；
+ * - 设置函数只有在数值真正变化时才标记控件失效；
+ * - 主循环调用 UI_Render()，只重绘失效控件并只刷新其所在区域。
+ ******************************************************************************
+ */
+
+#ifndef __UI_H
+#define __UI_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 配置 ---------------------------------------------------------------------*/
+#ifndef UI_WIDGET_MAX
+#define UI_WIDGET_MAX       16      ///< 控件池容量
+#endif
+
+#ifndef UI_TEXT_MAX
+#define UI_TEXT_MAX         16      ///< 标签文本最大字节数（含结束符）
+#endif
+
+/* 控件类型 -----------------------------------------------------------------*/
+#define UI_LABEL            0       ///< 文本标签
+#define UI_NUMBER           1       ///< 数值显示（右对齐十进制）
+#define UI_BAR              2       ///< 水平进度条
+#define UI_GAUGE            3       ///< 半圆仪表盘
+#define UI_ICON             4       ///< 图标
+#define UI_LIST             5       ///< 列表 / 菜单
+
+/* 控件标志 -----------------------------------------------------------------*/
+#define UI_FLAG_USED        0x01    ///< 已从控件池分配
+#define UI_FLAG_VISIBLE     0x02    ///< 可见
+#define UI_FLAG_INVALID     0x04    ///< 需要重绘
+
+/* 控件结构 -----------------------------------------------------------------*/
+typedef struct
+{
+	uint8_t Type;                   ///< 控件类型（UI_LABEL 等）
+	uint8_t Flags;                  ///< 控件标志（UI_FLAG_xxx）
+	uint8_t FontSize;               ///< 字体：OLED_8X16 / OLED_6X8
+	int16_t X, Y;                   ///< 包围盒左上角
+	uint8_t Width, Height;          ///< 包围盒尺寸
+	union
+	{
+		char Text[UI_TEXT_MAX];     ///< UI_LABEL：文本副本
+		struct
+		{
+			int32_t Value;          ///< 当前值
+			int32_t Min, Max;       ///< 取值范围（UI_BAR / UI_GAUGE）
+			uint8_t Length;         ///< 显示位数（UI_NUMBER）
+		} Num;
+		const uint8_t *Image;       ///< UI_ICON：图像数据
+		struct
+		{
+			const char * const *Items;  ///< 列表项文本
+			uint8_t Count;          ///< 列表项数量
+			uint8_t Top;            ///< 第一行显示的列表项
+			uint8_t Selected;       ///< 选中项
+		} List;
+	} u;
+} UI_Widget_t;
+
+/* 函数声明 -----------------------------------------------------------------*/
+void UI_Init(void);
+
+UI_Widget_t *UI_CreateLabel(int16_t X, int16_t Y, uint8_t Width, const char *Text, uint8_t FontSize);
+UI_Widget_t *UI_CreateNumber(int16_t X, int16_t Y, int32_t Value, uint8_t Length, uint8_t FontSize);
+UI_Widget_t *UI_CreateBar(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, int32_t Min, int32_t Max);
+UI_Widget_t *UI_CreateGauge(int16_t X, int16_t Y, uint8_t Radius, int32_t Min, int32_t Max);
+UI_Widget_t *UI_CreateIcon(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image);
+UI_Widget_t *UI_CreateList(int16_t X, int16_t Y, uint8_t Width, uint8_t Height,
+                           const char * const *Items, uint8_t Count, uint8_t FontSize);
+void UI_Delete(UI_Widget_t *Widget);
+
+void UI_SetText(UI_Widget_t *Widget, const char *Text);
+void UI_SetValue(UI_Widget_t *Widget, int32_t Value);
+void UI_SetImage(UI_Widget_t *Widget, const uint8_t *Image);
+void UI_SetSelected(UI_Widget_t *Widget, uint8_t Index);
+void UI_SetVisible(UI_Widget_t *Widget, uint8_t Visible);
+void UI_Invalidate(UI_Widget_t *Widget);
+
+uint8_t UI_Render(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UI_H */